@@ -16,10 +16,69 @@ ActionDataLoader& ActionDataLoader::GetInstance() {
 }
 
 bool ActionDataLoader::LoadActions(const std::string& filepath) {
-    try {
-        // Clear previous actions
-        actions.clear();
+    // Clear previous actions
+    actions.clear();
+    
+    std::cout << "Loading actions from: " << filepath << std::endl;
+    
+    std::unordered_map<Engine::StringId, std::shared_ptr<Action>> parsed;
+    if (!ParseActionsFile(filepath, parsed)) {
+        return false;
+    }
+    
+    for (auto& [id, action] : parsed) {
+        std::cout << "Loaded action: " << action->GetID() << " - " << action->GetName()
+                  << " (" << action->GetProgram().size() << " effects)" << std::endl;
+        actions[id] = std::make_shared<ActionRef>(std::move(action));
+    }
+    
+    std::cout << "Successfully loaded " << actions.size() << " actions" << std::endl;
+    return true;
+}
+
+bool ActionDataLoader::ReloadActions(const std::string& filepath, ContentReloadSummary& summary) {
+    summary = ContentReloadSummary();
+    
+    // Parse everything first, so a broken edit leaves the loaded table alone
+    std::unordered_map<Engine::StringId, std::shared_ptr<Action>> parsed;
+    if (!ParseActionsFile(filepath, parsed)) {
+        return false;
+    }
+    
+    for (auto& [id, action] : parsed) {
+        auto existing = actions.find(id);
+        if (existing == actions.end()) {
+            actions[id] = std::make_shared<ActionRef>(std::move(action));
+            summary.added++;
+            continue;
+        }
         
+        // Swap the new definition in behind the ID's reference: every
+        // entity holding the reference uses it from now on, while anything
+        // still holding the old definition keeps a valid, unchanged copy
+        ActionRef& ref = *existing->second;
+        if (!SameDefinition(*ref.definition, *action)) {
+            ref.definition = std::move(action);
+            summary.changed++;
+        }
+    }
+    
+    // Removed actions leave the table; holders keep their last version
+    for (auto it = actions.begin(); it != actions.end(); ) {
+        if (parsed.find(it->first) == parsed.end()) {
+            it = actions.erase(it);
+            summary.removed++;
+        } else {
+            ++it;
+        }
+    }
+    
+    return true;
+}
+
+bool ActionDataLoader::ParseActionsFile(const std::string& filepath,
+                                        std::unordered_map<Engine::StringId, std::shared_ptr<Action>>& parsed) const {
+    try {
         // Open and parse JSON file
         std::ifstream file(filepath);
         if (!file.is_open()) {
@@ -27,8 +86,6 @@ bool ActionDataLoader::LoadActions(const std::string& filepath) {
             return false;
         }
         
-        std::cout << "Loading actions from: " << filepath << std::endl;
-        
         // Parse JSON
         nlohmann::json actionsJson;
         file >> actionsJson;
@@ -68,6 +125,19 @@ bool ActionDataLoader::LoadActions(const std::string& filepath) {
                 action->SetCooldown(actionData["cooldown"]);
             }
             
+            // Set area of effect if available
+            if (actionData.contains("target_shape")) {
+                action->SetTargetShape(StringToTargetShape(actionData["target_shape"]));
+            }
+            
+            if (actionData.contains("area")) {
+                action->SetArea(actionData["area"]);
+            }
+            
+            if (actionData.contains("splash_percent")) {
+                action->SetSplashPercent(actionData["splash_percent"]);
+            }
+            
             // Set additional properties
             if (actionData.contains("properties") && actionData["properties"].is_object()) {
                 const auto& props = actionData["properties"];
@@ -76,13 +146,12 @@ bool ActionDataLoader::LoadActions(const std::string& filepath) {
                 }
             }
             
-            // Store the action
-            actions[id] = action;
+            // Compile the properties into a flat effect program once, up front
+            action->Compile();
             
-            std::cout << "Loaded action: " << id << " - " << name << std::endl;
+            parsed[action->GetKey()] = action;
         }
         
-        std::cout << "Successfully loaded " << actions.size() << " actions" << std::endl;
         return true;
         
     } catch (const std::exception& e) {
@@ -91,7 +160,91 @@ bool ActionDataLoader::LoadActions(const std::string& filepath) {
     }
 }
 
-std::shared_ptr<Action> ActionDataLoader::GetAction(const std::string& id) const {
+bool ActionDataLoader::SameDefinition(const Action& a, const Action& b) {
+    if (a.GetName() != b.GetName() || a.GetDescription() != b.GetDescription() || a.GetType() != b.GetType() ||
+        a.GetAccuracy() != b.GetAccuracy() || a.GetRange() != b.GetRange() || a.GetCooldown() != b.GetCooldown() ||
+        a.GetTargetShape() != b.GetTargetShape() || a.GetArea() != b.GetArea() ||
+        a.GetSplashPercent() != b.GetSplashPercent() || a.IsSelfOnly() != b.IsSelfOnly() ||
+        a.CanTargetSelf() != b.CanTargetSelf() || a.GetPositionChange() != b.GetPositionChange()) {
+        return false;
+    }
+    
+    // Properties only matter through the effects they compile into
+    const auto& programA = a.GetProgram();
+    const auto& programB = b.GetProgram();
+    if (programA.size() != programB.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < programA.size(); ++i) {
+        const EffectInstruction& x = programA[i];
+        const EffectInstruction& y = programB[i];
+        if (x.op != y.op || x.target != y.target || x.stat != y.stat || x.isPhysical != y.isPhysical ||
+            x.amount != y.amount || x.duration != y.duration) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ActionDataLoader::LoadActions(const ContentPack& pack) {
+    actions.clear();
+    actions.reserve(pack.GetActionCount());
+    
+    // Records were validated by the content compiler and bounds-checked
+    // when the pack was opened, so they map straight onto actions
+    const ContentPack::ActionRecord* records = pack.GetActions();
+    for (size_t i = 0; i < pack.GetActionCount(); ++i) {
+        const ContentPack::ActionRecord& record = records[i];
+        auto action = std::make_shared<Action>(std::string(pack.GetString(record.id)),
+                                               std::string(pack.GetString(record.name)),
+                                               static_cast<ActionType>(record.type));
+        action->SetDescription(std::string(pack.GetString(record.description)));
+        action->SetAccuracy(record.accuracy);
+        action->SetRange(record.range);
+        action->SetCooldown(record.cooldown);
+        action->SetTargetShape(static_cast<TargetShape>(record.targetShape));
+        action->SetArea(record.area);
+        action->SetSplashPercent(record.splashPercent);
+        
+        const ContentPack::PropertyRecord* properties = pack.GetActionProperties(record);
+        for (uint32_t p = 0; p < record.propertyCount; ++p) {
+            action->SetProperty(pack.GetString(properties[p].key), properties[p].value);
+        }
+        
+        action->Compile();
+        actions[action->GetKey()] = std::make_shared<ActionRef>(action);
+    }
+    
+    std::cout << "Loaded " << actions.size() << " actions from content pack" << std::endl;
+    return true;
+}
+
+std::shared_ptr<const Action> ActionDataLoader::GetAction(std::string_view id) const {
+    // An ID that was never interned cannot name a loaded action
+    Engine::StringId key;
+    if (!Engine::StringInterner::GetInstance().Find(id, key)) {
+        return nullptr;
+    }
+    return GetAction(key);
+}
+
+std::shared_ptr<const Action> ActionDataLoader::GetAction(Engine::StringId id) const {
+    auto it = actions.find(id);
+    if (it != actions.end()) {
+        return it->second->Get();
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const ActionRef> ActionDataLoader::GetActionRef(std::string_view id) const {
+    Engine::StringId key;
+    if (!Engine::StringInterner::GetInstance().Find(id, key)) {
+        return nullptr;
+    }
+    return GetActionRef(key);
+}
+
+std::shared_ptr<const ActionRef> ActionDataLoader::GetActionRef(Engine::StringId id) const {
     auto it = actions.find(id);
     if (it != actions.end()) {
         return it->second;
@@ -99,11 +252,15 @@ std::shared_ptr<Action> ActionDataLoader::GetAction(const std::string& id) const
     return nullptr;
 }
 
-bool ActionDataLoader::HasAction(const std::string& id) const {
+bool ActionDataLoader::HasAction(std::string_view id) const {
+    return GetAction(id) != nullptr;
+}
+
+bool ActionDataLoader::HasAction(Engine::StringId id) const {
     return actions.find(id) != actions.end();
 }
 
-const std::unordered_map<std::string, std::shared_ptr<Action>>& ActionDataLoader::GetAllActions() const {
+const std::unordered_map<Engine::StringId, std::shared_ptr<ActionRef>>& ActionDataLoader::GetAllActions() const {
     return actions;
 }
 
@@ -121,4 +278,15 @@ ActionType ActionDataLoader::StringToActionType(const std::string& typeStr) cons
     return ActionType::ATTACK;
 }
 
+TargetShape ActionDataLoader::StringToTargetShape(const std::string& shapeStr) const {
+    if (shapeStr == "SINGLE") return TargetShape::SINGLE;
+    if (shapeStr == "TILE_RANGE") return TargetShape::TILE_RANGE;
+    if (shapeStr == "SIDE") return TargetShape::SIDE;
+    if (shapeStr == "CHAIN") return TargetShape::CHAIN;
+    
+    // Default to SINGLE if unknown
+    std::cerr << "Unknown target shape: " << shapeStr << ", defaulting to SINGLE" << std::endl;
+    return TargetShape::SINGLE;
+}
+
 } // namespace Game 
\ No newline at end of file
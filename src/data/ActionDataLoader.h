@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <unordered_map>
 #include "DataLoader.h"
+#include "ContentPack.h"
 #include "../game/combat/Action.h"
 
 namespace Game {
@@ -17,14 +19,29 @@ public:
     // Load all actions from a JSON file
     bool LoadActions(const std::string& filepath);
     
-    // Get an action by ID
-    std::shared_ptr<Action> GetAction(const std::string& id) const;
+    // Load all actions from a compiled content pack (no JSON parsing)
+    bool LoadActions(const ContentPack& pack);
+    
+    // Re-read a JSON file and swap changed definitions in behind their
+    // ActionRef, so running battles use the new values on their next turn.
+    // Leaves everything untouched if the file fails to parse.
+    bool ReloadActions(const std::string& filepath, ContentReloadSummary& summary);
+    
+    // Get an action definition by ID (shared by every entity that uses it)
+    std::shared_ptr<const Action> GetAction(std::string_view id) const;
+    std::shared_ptr<const Action> GetAction(Engine::StringId id) const;
+    
+    // Get the stable reference to an action's current definition; hold this
+    // rather than the definition to follow reloads
+    std::shared_ptr<const ActionRef> GetActionRef(std::string_view id) const;
+    std::shared_ptr<const ActionRef> GetActionRef(Engine::StringId id) const;
     
     // Check if an action exists
-    bool HasAction(const std::string& id) const;
+    bool HasAction(std::string_view id) const;
+    bool HasAction(Engine::StringId id) const;
     
-    // Get all loaded actions
-    const std::unordered_map<std::string, std::shared_ptr<Action>>& GetAllActions() const;
+    // Get all loaded actions, keyed by interned ID
+    const std::unordered_map<Engine::StringId, std::shared_ptr<ActionRef>>& GetAllActions() const;
     
     // Get action count
     size_t GetActionCount() const { return actions.size(); }
@@ -36,11 +53,22 @@ private:
     // Static instance
     static ActionDataLoader* instance;
     
-    // Map of loaded actions
-    std::unordered_map<std::string, std::shared_ptr<Action>> actions;
+    // Loaded actions by ID. Definitions are never modified after loading;
+    // a reload points the ID's ActionRef at a new one instead.
+    std::unordered_map<Engine::StringId, std::shared_ptr<ActionRef>> actions;
+    
+    // Parse every action in a JSON file without touching the loaded table
+    bool ParseActionsFile(const std::string& filepath,
+                          std::unordered_map<Engine::StringId, std::shared_ptr<Action>>& parsed) const;
+    
+    // Whether two definitions behave the same in combat
+    static bool SameDefinition(const Action& a, const Action& b);
     
     // Helper to convert string to ActionType
     ActionType StringToActionType(const std::string& typeStr) const;
+    
+    // Helper to convert string to TargetShape
+    TargetShape StringToTargetShape(const std::string& shapeStr) const;
 };
 
 } // namespace Game 
\ No newline at end of file
@@ -0,0 +1,243 @@
+#include "ContentPack.h"
+#include "../game/combat/Action.h"
+#include <cstring>
+#include <iostream>
+
+namespace Game {
+
+namespace {
+
+static_assert(sizeof(ContentPack::Header) == 24, "Pack header is part of the file format");
+static_assert(sizeof(ContentPack::Section) == 24, "Section entries are part of the file format");
+static_assert(sizeof(ContentPack::ActionRecord) == 56, "Action records are part of the file format");
+static_assert(sizeof(ContentPack::PropertyRecord) == 16, "Property records are part of the file format");
+static_assert(sizeof(ContentPack::ItemRecord) == 64, "Item records are part of the file format");
+static_assert(sizeof(ContentPack::EnemyRecord) == 80, "Enemy records are part of the file format");
+static_assert(sizeof(ContentPack::LootTableRecord) == 16, "Loot table records are part of the file format");
+static_assert(sizeof(ContentPack::LootEntryRecord) == 40, "Loot entry records are part of the file format");
+
+uint32_t ByteSwap32(uint32_t value) {
+    return ((value & 0xFF) << 24) | ((value & 0xFF00) << 8) |
+           ((value >> 8) & 0xFF00) | (value >> 24);
+}
+
+void Fail(const std::string& filePath, const char* reason) {
+    std::cerr << "Error loading content pack " << filePath << ": " << reason << std::endl;
+}
+
+} // namespace
+
+ContentPack::ContentPack()
+    : strings(nullptr),
+      stringsSize(0),
+      actions(nullptr),
+      actionCount(0),
+      properties(nullptr),
+      propertyCount(0),
+      items(nullptr),
+      itemCount(0),
+      enemies(nullptr),
+      enemyCount(0),
+      enemyActions(nullptr),
+      enemyActionCount(0),
+      lootTables(nullptr),
+      lootTableCount(0),
+      lootEntries(nullptr),
+      lootEntryCount(0) {
+}
+
+bool ContentPack::Open(const std::string& filePath) {
+    Close();
+    if (!mapping.Open(filePath)) {
+        return false;
+    }
+
+    const unsigned char* data = mapping.GetData();
+    const uint64_t fileSize = mapping.GetSize();
+
+    Header header;
+    if (fileSize < sizeof(Header)) {
+        Fail(filePath, "file is too small");
+        Close();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.magic != MAGIC) {
+        Fail(filePath, header.magic == ByteSwap32(MAGIC) ? "written with a different byte order" : "not a content pack");
+        Close();
+        return false;
+    }
+    if (header.version != VERSION) {
+        Fail(filePath, "unsupported version (rebuild it with 'make content')");
+        Close();
+        return false;
+    }
+    if (header.headerSize != sizeof(Header) || header.fileSize != fileSize ||
+        header.sectionCount > (fileSize - sizeof(Header)) / sizeof(Section)) {
+        Fail(filePath, "corrupt header");
+        Close();
+        return false;
+    }
+
+    // Pointer fixups: each known section's offset becomes a pointer into
+    // the mapping, once, after its bounds and alignment are checked
+    const Section* sections = reinterpret_cast<const Section*>(data + sizeof(Header));
+    for (uint32_t i = 0; i < header.sectionCount; ++i) {
+        const Section& section = sections[i];
+        if (section.offset % 8 != 0 || section.offset > fileSize || section.size > fileSize - section.offset) {
+            Fail(filePath, "section out of bounds");
+            Close();
+            return false;
+        }
+
+        const unsigned char* sectionData = data + section.offset;
+        uint64_t recordSize = 0;
+        switch (static_cast<SectionKind>(section.kind)) {
+            case SectionKind::STRINGS:
+                strings = reinterpret_cast<const char*>(sectionData);
+                stringsSize = section.size;
+                continue;
+            case SectionKind::ACTIONS:
+                actions = reinterpret_cast<const ActionRecord*>(sectionData);
+                actionCount = section.count;
+                recordSize = sizeof(ActionRecord);
+                break;
+            case SectionKind::ACTION_PROPERTIES:
+                properties = reinterpret_cast<const PropertyRecord*>(sectionData);
+                propertyCount = section.count;
+                recordSize = sizeof(PropertyRecord);
+                break;
+            case SectionKind::ITEMS:
+                items = reinterpret_cast<const ItemRecord*>(sectionData);
+                itemCount = section.count;
+                recordSize = sizeof(ItemRecord);
+                break;
+            case SectionKind::ENEMIES:
+                enemies = reinterpret_cast<const EnemyRecord*>(sectionData);
+                enemyCount = section.count;
+                recordSize = sizeof(EnemyRecord);
+                break;
+            case SectionKind::ENEMY_ACTIONS:
+                enemyActions = reinterpret_cast<const StringRef*>(sectionData);
+                enemyActionCount = section.count;
+                recordSize = sizeof(StringRef);
+                break;
+            case SectionKind::LOOT_TABLES:
+                lootTables = reinterpret_cast<const LootTableRecord*>(sectionData);
+                lootTableCount = section.count;
+                recordSize = sizeof(LootTableRecord);
+                break;
+            case SectionKind::LOOT_ENTRIES:
+                lootEntries = reinterpret_cast<const LootEntryRecord*>(sectionData);
+                lootEntryCount = section.count;
+                recordSize = sizeof(LootEntryRecord);
+                break;
+            default:
+                // Content this reader does not know about
+                continue;
+        }
+
+        if (section.size != section.count * recordSize) {
+            Fail(filePath, "section size does not match its records");
+            Close();
+            return false;
+        }
+    }
+
+    if (!ValidateRecords(filePath)) {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void ContentPack::Close() {
+    mapping.Close();
+    strings = nullptr;
+    stringsSize = 0;
+    actions = nullptr;
+    actionCount = 0;
+    properties = nullptr;
+    propertyCount = 0;
+    items = nullptr;
+    itemCount = 0;
+    enemies = nullptr;
+    enemyCount = 0;
+    enemyActions = nullptr;
+    enemyActionCount = 0;
+    lootTables = nullptr;
+    lootTableCount = 0;
+    lootEntries = nullptr;
+    lootEntryCount = 0;
+}
+
+bool ContentPack::ValidateRecords(const std::string& filePath) const {
+    auto fits = [this](StringRef ref) {
+        return ref.offset <= stringsSize && ref.length <= stringsSize - ref.offset;
+    };
+
+    for (size_t i = 0; i < actionCount; ++i) {
+        const ActionRecord& action = actions[i];
+        if (!fits(action.id) || !fits(action.name) || !fits(action.description) ||
+            action.type > static_cast<uint8_t>(ActionType::COMPOUND) ||
+            action.targetShape > static_cast<uint8_t>(TargetShape::CHAIN) ||
+            action.firstProperty > propertyCount || action.propertyCount > propertyCount - action.firstProperty) {
+            Fail(filePath, "corrupt action record");
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < propertyCount; ++i) {
+        if (!fits(properties[i].key)) {
+            Fail(filePath, "corrupt property record");
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < itemCount; ++i) {
+        const ItemRecord& item = items[i];
+        if (!fits(item.id) || !fits(item.name) || !fits(item.description) || !fits(item.equipSlot)) {
+            Fail(filePath, "corrupt item record");
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < enemyCount; ++i) {
+        const EnemyRecord& enemy = enemies[i];
+        if (!fits(enemy.id) || !fits(enemy.name) || enemy.firstAction > enemyActionCount ||
+            enemy.actionCount > enemyActionCount - enemy.firstAction) {
+            Fail(filePath, "corrupt enemy record");
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < enemyActionCount; ++i) {
+        if (!fits(enemyActions[i])) {
+            Fail(filePath, "corrupt enemy action reference");
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < lootTableCount; ++i) {
+        const LootTableRecord& table = lootTables[i];
+        if (!fits(table.id) || table.firstEntry > lootEntryCount ||
+            table.entryCount > lootEntryCount - table.firstEntry) {
+            Fail(filePath, "corrupt loot table record");
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < lootEntryCount; ++i) {
+        const LootEntryRecord& entry = lootEntries[i];
+        if (!fits(entry.target) || entry.minCount < 0 || entry.maxCount < entry.minCount) {
+            Fail(filePath, "corrupt loot entry record");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Game 
\ No newline at end of file
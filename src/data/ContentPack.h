@@ -0,0 +1,197 @@
+#pragma once
+
+#include "../engine/core/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Game {
+
+/**
+ * Compiled binary content pack (actions, items, enemies, loot, ...).
+ *
+ * Packs are produced at build time by tools/content_compiler.cpp, which
+ * validates the JSON schemas and lays the content out as flat, fixed-size
+ * records plus one string table. At startup the game maps the pack
+ * read-only in a single call; Open checks the header, resolves each
+ * section's offset to a pointer into the mapping once, and validates every
+ * string reference and property range, so the accessors below can be used
+ * without further checks and no JSON is parsed at all.
+ *
+ * Layout: a Header, then sectionCount Section entries, then the section
+ * data, each on an 8-byte boundary. Sections of unknown kinds are skipped,
+ * so new content types can be added without breaking older readers; any
+ * change to an existing record bumps VERSION. Values are stored in the
+ * host's byte order, like floor files.
+ */
+class ContentPack {
+public:
+    static constexpr uint32_t MAGIC = 0x4B505052;   // "RPPK"
+    static constexpr uint32_t VERSION = 1;
+
+    // Where 'make content' writes the pack, relative to the working directory
+    static constexpr const char* DEFAULT_PATH = "build/content.pack";
+
+    // Difficulty tiers with their own enemy spawn weights
+    static constexpr uint32_t ENEMY_TIERS = 4;
+
+    // Treasure quality tiers with their own loot weights
+    static constexpr uint32_t LOOT_TIERS = 4;
+
+    enum class SectionKind : uint32_t {
+        STRINGS = 1,
+        ACTIONS = 2,
+        ACTION_PROPERTIES = 3,
+        ITEMS = 4,
+        ENEMIES = 5,
+        ENEMY_ACTIONS = 6,
+        LOOT_TABLES = 7,
+        LOOT_ENTRIES = 8
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t headerSize;
+        uint32_t sectionCount;
+        uint64_t fileSize;
+    };
+
+    struct Section {
+        uint32_t kind;
+        uint32_t count;         // Number of records (bytes for STRINGS)
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    // A string in the string table (not null-terminated)
+    struct StringRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    // An action with every field resolved; missing JSON fields hold the
+    // Action defaults
+    struct ActionRecord {
+        StringRef id;
+        StringRef name;
+        StringRef description;
+        uint8_t type;               // ActionType
+        uint8_t targetShape;        // TargetShape
+        uint8_t reserved[2];
+        int32_t accuracy;
+        int32_t range;
+        int32_t cooldown;
+        int32_t area;
+        int32_t splashPercent;
+        uint32_t firstProperty;     // Range in the ACTION_PROPERTIES section
+        uint32_t propertyCount;
+    };
+
+    // Named integer property of an action ("damage", "heal_amount", ...)
+    struct PropertyRecord {
+        StringRef key;
+        int32_t value;
+        int32_t reserved;
+    };
+
+    struct ItemRecord {
+        StringRef id;
+        StringRef name;
+        StringRef description;
+        StringRef equipSlot;
+        int32_t value;
+        int32_t weight;
+        uint8_t equippable;
+        uint8_t reserved[3];
+        int32_t strBonus;
+        int32_t dexBonus;
+        int32_t conBonus;
+        int32_t intBonus;
+        int32_t spdBonus;
+    };
+
+    // An enemy archetype. Each stat is 5 + level + its offset; a positive
+    // health overrides Constitution to reach health + healthPerLevel * level.
+    struct EnemyRecord {
+        StringRef id;
+        StringRef name;
+        int32_t statOffsets[7];     // In StatType order
+        int32_t health;
+        int32_t healthPerLevel;
+        uint32_t firstAction;       // Range of action IDs in the ENEMY_ACTIONS section
+        uint32_t actionCount;
+        uint32_t spawnWeights[ENEMY_TIERS];
+        uint32_t reserved;
+    };
+
+    struct LootTableRecord {
+        StringRef id;
+        uint32_t firstEntry;        // Range in the LOOT_ENTRIES section
+        uint32_t entryCount;
+    };
+
+    // One outcome of a loot roll: count copies of an item, or count rolls
+    // on another table. Its weight in each quality tier is relative to the
+    // other entries of the same table.
+    struct LootEntryRecord {
+        StringRef target;           // Item ID or loot table ID
+        uint8_t isTable;
+        uint8_t reserved[3];
+        int32_t minCount;
+        int32_t maxCount;
+        uint32_t weights[LOOT_TIERS];
+        uint32_t reserved2;
+    };
+
+    ContentPack();
+
+    // Map and validate a pack; returns false (and logs) if it is missing or invalid
+    bool Open(const std::string& filePath);
+    void Close();
+    bool IsOpen() const { return mapping.IsOpen(); }
+
+    // Size of the mapped pack in bytes
+    size_t GetSize() const { return mapping.GetSize(); }
+
+    std::string_view GetString(StringRef ref) const { return std::string_view(strings + ref.offset, ref.length); }
+
+    // Records, valid while the pack stays open
+    const ActionRecord* GetActions() const { return actions; }
+    size_t GetActionCount() const { return actionCount; }
+    const PropertyRecord* GetActionProperties(const ActionRecord& action) const { return properties + action.firstProperty; }
+    const ItemRecord* GetItems() const { return items; }
+    size_t GetItemCount() const { return itemCount; }
+    const EnemyRecord* GetEnemies() const { return enemies; }
+    size_t GetEnemyCount() const { return enemyCount; }
+    const StringRef* GetEnemyActions(const EnemyRecord& enemy) const { return enemyActions + enemy.firstAction; }
+    const LootTableRecord* GetLootTables() const { return lootTables; }
+    size_t GetLootTableCount() const { return lootTableCount; }
+    const LootEntryRecord* GetLootEntries(const LootTableRecord& table) const { return lootEntries + table.firstEntry; }
+
+private:
+    bool ValidateRecords(const std::string& filePath) const;
+
+    Engine::MappedFile mapping;
+
+    // Section pointers into the mapping, resolved by Open
+    const char* strings;
+    uint64_t stringsSize;
+    const ActionRecord* actions;
+    size_t actionCount;
+    const PropertyRecord* properties;
+    size_t propertyCount;
+    const ItemRecord* items;
+    size_t itemCount;
+    const EnemyRecord* enemies;
+    size_t enemyCount;
+    const StringRef* enemyActions;
+    size_t enemyActionCount;
+    const LootTableRecord* lootTables;
+    size_t lootTableCount;
+    const LootEntryRecord* lootEntries;
+    size_t lootEntryCount;
+};
+
+} // namespace Game 
\ No newline at end of file
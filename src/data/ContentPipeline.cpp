@@ -0,0 +1,186 @@
+#include "ContentPipeline.h"
+#include "ActionDataLoader.h"
+#include "ContentPack.h"
+#include "EnemyTable.h"
+#include "LootTables.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+
+namespace Game {
+
+namespace {
+
+// Open the compiled content pack unless the JSON it was built from has been
+// edited since, so a stale build/content.pack never hides a source change
+bool OpenCurrentPack(ContentPack& pack, const char* sourcePath) {
+    std::error_code packError;
+    std::error_code sourceError;
+    auto packTime = std::filesystem::last_write_time(ContentPack::DEFAULT_PATH, packError);
+    auto sourceTime = std::filesystem::last_write_time(sourcePath, sourceError);
+    if (packError) {
+        return false;
+    }
+    if (!sourceError && sourceTime > packTime) {
+        std::cerr << sourcePath << " is newer than " << ContentPack::DEFAULT_PATH
+                  << "; loading the JSON source instead" << std::endl;
+        return false;
+    }
+    return pack.Open(ContentPack::DEFAULT_PATH);
+}
+
+} // namespace
+
+ContentPipeline& ContentPipeline::GetInstance() {
+    static ContentPipeline pipeline;
+    return pipeline;
+}
+
+ContentPipeline::ContentPipeline()
+    : workerCount(0),
+      nextPack(0),
+      finishedPacks(0),
+      started(false),
+      ready(readyPromise.get_future().share()),
+      loadMs(0.0) {
+    RegisterDefaultPacks();
+}
+
+ContentPipeline::~ContentPipeline() {
+    for (std::thread& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void ContentPipeline::RegisterDefaultPacks() {
+    // Each pack prefers the compiled content pack and falls back to its
+    // JSON source when there is no pack or the source is newer, then checks
+    // that it actually produced content
+    AddPack("actions", []() {
+        ActionDataLoader& loader = ActionDataLoader::GetInstance();
+        ContentPack pack;
+        const char* source = "src/data/schemas/actions.json";
+        bool loaded = OpenCurrentPack(pack, source)
+            ? loader.LoadActions(pack)
+            : loader.LoadActions(source);
+        return loaded && loader.GetActionCount() > 0;
+    });
+
+    AddPack("items", [this]() {
+        ContentPack pack;
+        const char* source = "src/data/schemas/items.json";
+        bool loaded = OpenCurrentPack(pack, source)
+            ? items.LoadFromRecords(pack, pack.GetItems(), pack.GetItemCount())
+            : items.LoadFromFile(source);
+        return loaded && !items.GetItems().empty();
+    });
+
+    AddPack("enemies", []() {
+        // Packs compiled before enemies existed have no enemy section
+        EnemyTable& table = EnemyTable::GetInstance();
+        ContentPack pack;
+        const char* source = "src/data/schemas/enemies.json";
+        bool loaded = OpenCurrentPack(pack, source) && pack.GetEnemyCount() > 0
+            ? table.Load(pack)
+            : table.LoadFromFile(source);
+        return loaded && table.GetEnemyCount() > 0;
+    });
+
+    AddPack("loot", []() {
+        LootTables& lootTables = LootTables::GetInstance();
+        ContentPack pack;
+        const char* source = "src/data/schemas/loot.json";
+        bool loaded = OpenCurrentPack(pack, source) && pack.GetLootTableCount() > 0
+            ? lootTables.Load(pack)
+            : lootTables.LoadFromFile(source);
+        return loaded && lootTables.GetTableCount() > 0;
+    });
+}
+
+void ContentPipeline::AddPack(const std::string& name, LoadFunction load) {
+    if (started) {
+        std::cerr << "Content pack " << name << " registered after loading started; ignored" << std::endl;
+        return;
+    }
+    packs.push_back(Pack{name, std::move(load)});
+}
+
+void ContentPipeline::Start(int threadCount) {
+    if (started.exchange(true)) {
+        return;
+    }
+
+    startTime = std::chrono::steady_clock::now();
+    if (packs.empty()) {
+        readyPromise.set_value(true);
+        return;
+    }
+
+    int hardwareThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int count = threadCount > 0 ? threadCount : hardwareThreads;
+    count = std::min(count, static_cast<int>(packs.size()));
+
+    // Set before any worker runs, since they report it
+    workerCount = static_cast<size_t>(count);
+    for (int i = 0; i < count; ++i) {
+        workers.emplace_back(&ContentPipeline::WorkerLoop, this);
+    }
+}
+
+void ContentPipeline::WorkerLoop() {
+    for (size_t index = nextPack++; index < packs.size(); index = nextPack++) {
+        const Pack& pack = packs[index];
+
+        bool loaded = false;
+        try {
+            loaded = pack.load();
+        } catch (const std::exception& e) {
+            std::cerr << "Error loading content pack " << pack.name << ": " << e.what() << std::endl;
+        }
+
+        if (!loaded) {
+            std::cerr << "Content pack " << pack.name << " failed to load" << std::endl;
+            std::lock_guard<std::mutex> lock(mutex);
+            failedPacks.push_back(pack.name);
+        }
+
+        // The worker that finishes the last pack resolves the future
+        if (++finishedPacks == packs.size()) {
+            loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            bool allLoaded;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                allLoaded = failedPacks.empty();
+            }
+            std::cout << "Loaded " << packs.size() << " content packs on " << workerCount
+                      << " threads in " << loadMs << " ms" << std::endl;
+            readyPromise.set_value(allLoaded);
+        }
+    }
+}
+
+float ContentPipeline::GetProgress() const {
+    if (packs.empty()) {
+        return started ? 1.0f : 0.0f;
+    }
+    return static_cast<float>(finishedPacks) / static_cast<float>(packs.size());
+}
+
+bool ContentPipeline::IsReady() const {
+    return ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool ContentPipeline::WaitUntilReady() {
+    Start();
+    return ready.get();
+}
+
+std::vector<std::string> ContentPipeline::GetFailedPacks() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return failedPacks;
+}
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "schemas/ItemData.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Game {
+
+// Loads and validates every content pack at startup, in parallel.
+//
+// Each pack (actions, items, and later enemies or encounters) is one job;
+// a small pool of worker threads takes jobs until none are left, so packs
+// load concurrently with each other and with whatever the main thread does
+// meanwhile (Application::Initialize starts the pipeline before creating
+// the window). Progress can be polled every frame, and the ready future
+// resolves once every pack has finished, with true if all of them loaded.
+//
+// Packs are registered before Start and must only touch their own tables;
+// nothing may read those tables until the pipeline is ready.
+class ContentPipeline {
+public:
+    using LoadFunction = std::function<bool()>;
+
+    static ContentPipeline& GetInstance();
+
+    // Register a pack (ignored once the pipeline has started)
+    void AddPack(const std::string& name, LoadFunction load);
+
+    // Start loading on up to threadCount workers (0 = one per hardware
+    // thread); does nothing if already started
+    void Start(int threadCount = 0);
+
+    // Fraction of packs finished (0 to 1)
+    float GetProgress() const;
+    bool IsReady() const;
+
+    // Resolves when every pack has finished; true if all loaded
+    std::shared_future<bool> GetReadyFuture() const { return ready; }
+
+    // Start if needed, block until ready, and return whether all packs loaded
+    bool WaitUntilReady();
+
+    // Packs that failed to load or validate
+    std::vector<std::string> GetFailedPacks() const;
+
+    // Wall time from Start until the last pack finished
+    double GetLoadMilliseconds() const { return loadMs; }
+
+    // Item table filled by the "items" pack (main thread only once ready)
+    const ItemLoader& GetItems() const { return items; }
+    ItemLoader& GetItems() { return items; }
+
+private:
+    struct Pack {
+        std::string name;
+        LoadFunction load;
+    };
+
+    ContentPipeline();
+    ~ContentPipeline();
+
+    ContentPipeline(const ContentPipeline&) = delete;
+    ContentPipeline& operator=(const ContentPipeline&) = delete;
+
+    void WorkerLoop();
+    void RegisterDefaultPacks();
+
+    std::vector<Pack> packs;
+    std::vector<std::thread> workers;
+    size_t workerCount;
+    std::atomic<size_t> nextPack;
+    std::atomic<size_t> finishedPacks;
+    std::atomic<bool> started;
+
+    mutable std::mutex mutex;
+    std::vector<std::string> failedPacks;
+
+    std::promise<bool> readyPromise;
+    std::shared_future<bool> ready;
+    std::chrono::steady_clock::time_point startTime;
+    double loadMs;
+
+    // Tables owned by the pipeline
+    ItemLoader items;
+};
+
+} // namespace Game 
\ No newline at end of file
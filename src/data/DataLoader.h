@@ -1,11 +1,17 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
-#include <memory>
+#include <vector>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <chrono>
 #include "json.hpp"
+#include "ContentPack.h"
+#include "JsonEntryStream.h"
+#include "../engine/core/StringInterner.h"
 
 // For convenience
 using json = nlohmann::json;
@@ -24,51 +30,108 @@ public:
     virtual json ToJson() const = 0;
 };
 
-// Generic data loader for loading JSON files
+// What a content reload changed (entries are matched by ID)
+struct ContentReloadSummary {
+    int changed = 0;
+    int added = 0;
+    int removed = 0;
+};
+
+// Size and speed of the last file load
+struct ContentLoadStats {
+    size_t bytes = 0;
+    size_t items = 0;
+    double seconds = 0.0;
+    
+    double GetMegabytesPerSecond() const { return seconds > 0.0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0; }
+};
+
+// Generic data loader for loading JSON files.
+//
+// Items are stored by value in one contiguous vector, with their interned
+// IDs in a parallel vector and a hash index from ID to handle. Bulk
+// iteration is a linear walk over GetItems()/GetKeys(); single lookups go
+// through the index. A handle names the same item for as long as it stays
+// loaded, including across hot reloads and removals of other items, and is
+// never handed out again, even after Clear or a full load. Meanwhile
+// pointers and references returned by lookups are only valid until the next
+// item is added or removed. Hold handles, not pointers, across frames.
 template<typename T>
 class DataLoader {
 public:
+    // Stable reference to a loaded item
+    using Handle = uint32_t;
+    static constexpr Handle INVALID_HANDLE = UINT32_MAX;
+    
     DataLoader() = default;
     
-    // Load data from a JSON file
+    // Load data from a JSON file. The file is streamed: each entry is
+    // parsed, turned into a T and dropped before the next one is read, so
+    // large packs never exist as a whole DOM. On failure the previously
+    // loaded items are kept.
     bool LoadFromFile(const std::string& filePath) {
-        try {
-            // Read file
-            std::ifstream file(filePath);
-            if (!file.is_open()) {
-                std::cerr << "Failed to open file: " << filePath << std::endl;
-                return false;
-            }
-            
-            // Parse JSON
-            json data = json::parse(file);
-            
-            // Load data into objects
-            return LoadFromJson(data);
+        auto start = std::chrono::steady_clock::now();
+        
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open file: " << filePath << std::endl;
+            return false;
         }
-        catch (const std::exception& e) {
-            std::cerr << "Error loading from file " << filePath << ": " << e.what() << std::endl;
+        file.seekg(0, std::ios::end);
+        const std::streamoff fileSize = file.tellg();
+        file.seekg(0, std::ios::beg);
+        
+        // Number the new items after every handle this loader has issued
+        DataLoader<T> loaded;
+        loaded.handleBase = handleBase + static_cast<Handle>(slots.size());
+        bool entryFailed = false;
+        JsonEntryStream stream([&](const std::string& key, const json& value) {
+            if (entryFailed) {
+                return;
+            }
+            try {
+                T item;
+                if constexpr (std::is_base_of<JsonSerializable, T>::value) {
+                    item.FromJson(value);
+                }
+                loaded.SetItem(key, std::move(item));
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Error loading " << key << " from " << filePath << ": " << e.what() << std::endl;
+                entryFailed = true;
+            }
+        });
+        
+        if (!stream.Parse(file, filePath) || entryFailed) {
             return false;
         }
+        
+        TakeItems(std::move(loaded));
+        lastLoadStats.bytes = fileSize > 0 ? static_cast<size_t>(fileSize) : 0;
+        lastLoadStats.items = items.size();
+        lastLoadStats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return true;
     }
     
+    // Size and throughput of the last successful LoadFromFile
+    const ContentLoadStats& GetLastLoadStats() const { return lastLoadStats; }
+    
     // Load data from JSON
     bool LoadFromJson(const json& data) {
         try {
-            items.clear();
+            Clear();
+            items.reserve(data.size());
             
             // Parse each item in the JSON
             for (auto& [key, value] : data.items()) {
-                // Create object
-                auto item = std::make_shared<T>();
+                T item;
                 
                 // Parse from JSON if it's a JsonSerializable
                 if constexpr (std::is_base_of<JsonSerializable, T>::value) {
-                    item->FromJson(value);
+                    item.FromJson(value);
                 }
                 
-                // Store item
-                items[key] = item;
+                SetItem(key, std::move(item));
             }
             
             return true;
@@ -79,6 +142,68 @@ public:
         }
     }
     
+    // Re-read a JSON file and patch the loaded items in place. Changed
+    // items keep their handle and slot, new keys are added and missing keys
+    // removed. A file that fails to parse leaves everything untouched.
+    bool ReloadFromFile(const std::string& filePath, ContentReloadSummary& summary) {
+        // Items are compared through their JSON form; anything else would
+        // report every item as changed
+        static_assert(std::is_base_of<JsonSerializable, T>::value,
+                      "ReloadFromFile requires a JsonSerializable item type");
+        summary = ContentReloadSummary();
+        
+        DataLoader<T> fresh;
+        if (!fresh.LoadFromFile(filePath)) {
+            return false;
+        }
+        
+        for (size_t i = 0; i < fresh.items.size(); ++i) {
+            Handle handle = Find(fresh.keys[i]);
+            if (handle == INVALID_HANDLE) {
+                SetItem(fresh.keys[i], std::move(fresh.items[i]));
+                summary.added++;
+                continue;
+            }
+            
+            T& existing = Get(handle);
+            if (existing.ToJson() != fresh.items[i].ToJson()) {
+                existing = std::move(fresh.items[i]);
+                summary.changed++;
+            }
+        }
+        
+        // Collect first: removing moves the last item into the hole
+        std::vector<Engine::StringId> removed;
+        for (Engine::StringId key : keys) {
+            if (fresh.Find(key) == INVALID_HANDLE) {
+                removed.push_back(key);
+            }
+        }
+        for (Engine::StringId key : removed) {
+            RemoveItem(key);
+            summary.removed++;
+        }
+        
+        return true;
+    }
+    
+    // Load data from compiled pack records (see ContentPack). T provides
+    // FromRecord(const ContentPack&, const Record&); no JSON is involved.
+    template<typename Record>
+    bool LoadFromRecords(const ContentPack& pack, const Record* records, size_t count) {
+        Clear();
+        items.reserve(count);
+        keys.reserve(count);
+        
+        for (size_t i = 0; i < count; ++i) {
+            T item;
+            item.FromRecord(pack, records[i]);
+            SetItem(pack.GetString(records[i].id), std::move(item));
+        }
+        
+        return true;
+    }
+    
     // Save data to a JSON file
     bool SaveToFile(const std::string& filePath) {
         try {
@@ -104,53 +229,147 @@ public:
     // Convert all items to JSON
     json ToJson() const {
         json data;
+        Engine::StringInterner& interner = Engine::StringInterner::GetInstance();
         
-        for (const auto& [key, item] : items) {
+        for (size_t i = 0; i < items.size(); ++i) {
             // Convert to JSON if it's a JsonSerializable
             if constexpr (std::is_base_of<JsonSerializable, T>::value) {
-                data[key] = item->ToJson();
+                data[interner.Get(keys[i])] = items[i].ToJson();
             }
         }
         
         return data;
     }
     
-    // Access items
-    std::shared_ptr<T> GetItem(const std::string& key) const {
-        auto it = items.find(key);
-        if (it != items.end()) {
-            return it->second;
-        }
-        return nullptr;
+    // Handle of an item (INVALID_HANDLE if not loaded)
+    Handle Find(std::string_view key) const {
+        // A key that was never interned cannot name a loaded item
+        Engine::StringId id;
+        return Engine::StringInterner::GetInstance().Find(key, id) ? Find(id) : INVALID_HANDLE;
+    }
+    
+    Handle Find(Engine::StringId key) const {
+        auto it = index.find(key);
+        return it != index.end() ? it->second : INVALID_HANDLE;
+    }
+    
+    // Whether a handle still names a loaded item
+    bool IsValid(Handle handle) const {
+        return handle >= handleBase && handle - handleBase < slots.size() &&
+               slots[handle - handleBase] != INVALID_HANDLE;
+    }
+    
+    // Access an item by handle (the handle must be valid)
+    const T& Get(Handle handle) const { return items[slots[handle - handleBase]]; }
+    T& Get(Handle handle) { return items[slots[handle - handleBase]]; }
+    Engine::StringId GetKey(Handle handle) const { return keys[slots[handle - handleBase]]; }
+    
+    // Access items by key (nullptr if not loaded)
+    const T* GetItem(std::string_view key) const {
+        Handle handle = Find(key);
+        return handle != INVALID_HANDLE ? &Get(handle) : nullptr;
+    }
+    
+    const T* GetItem(Engine::StringId key) const {
+        Handle handle = Find(key);
+        return handle != INVALID_HANDLE ? &Get(handle) : nullptr;
     }
     
     // Check if an item exists
-    bool HasItem(const std::string& key) const {
-        return items.find(key) != items.end();
+    bool HasItem(std::string_view key) const {
+        return Find(key) != INVALID_HANDLE;
     }
     
-    // Add or update an item
-    void SetItem(const std::string& key, std::shared_ptr<T> item) {
-        items[key] = item;
+    bool HasItem(Engine::StringId key) const {
+        return Find(key) != INVALID_HANDLE;
     }
     
-    // Remove an item
-    void RemoveItem(const std::string& key) {
-        items.erase(key);
+    // Add or update an item; returns its handle
+    Handle SetItem(std::string_view key, T item) {
+        return SetItem(Engine::StringInterner::GetInstance().Intern(key), std::move(item));
     }
     
-    // Get all items
-    const std::unordered_map<std::string, std::shared_ptr<T>>& GetItems() const {
-        return items;
+    Handle SetItem(Engine::StringId key, T item) {
+        Handle handle = Find(key);
+        if (handle != INVALID_HANDLE) {
+            Get(handle) = std::move(item);
+            return handle;
+        }
+        
+        // Handles are never reused, so a stale one can't name another item
+        handle = handleBase + static_cast<Handle>(slots.size());
+        slots.push_back(static_cast<uint32_t>(items.size()));
+        items.push_back(std::move(item));
+        keys.push_back(key);
+        handles.push_back(handle);
+        index.emplace(key, handle);
+        return handle;
     }
     
-    // Clear all items
+    // Remove an item. The last item moves into its slot, so storage stays
+    // contiguous; every other handle stays valid.
+    void RemoveItem(std::string_view key) {
+        Engine::StringId id;
+        if (Engine::StringInterner::GetInstance().Find(key, id)) {
+            RemoveItem(id);
+        }
+    }
+    
+    void RemoveItem(Engine::StringId key) {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return;
+        }
+        
+        uint32_t slot = slots[it->second - handleBase];
+        uint32_t last = static_cast<uint32_t>(items.size() - 1);
+        if (slot != last) {
+            items[slot] = std::move(items[last]);
+            keys[slot] = keys[last];
+            handles[slot] = handles[last];
+            slots[handles[slot] - handleBase] = slot;
+        }
+        items.pop_back();
+        keys.pop_back();
+        handles.pop_back();
+        
+        slots[it->second - handleBase] = INVALID_HANDLE;
+        index.erase(it);
+    }
+    
+    // All items, contiguous, with their IDs at the same positions in GetKeys()
+    const std::vector<T>& GetItems() const { return items; }
+    const std::vector<Engine::StringId>& GetKeys() const { return keys; }
+    size_t GetItemCount() const { return items.size(); }
+    
+    // Clear all items (outstanding handles become invalid for good)
     void Clear() {
+        handleBase += static_cast<Handle>(slots.size());
         items.clear();
+        keys.clear();
+        handles.clear();
+        slots.clear();
+        index.clear();
     }
     
 private:
-    std::unordered_map<std::string, std::shared_ptr<T>> items;
+    // Replace the contents with another loader's
+    void TakeItems(DataLoader<T>&& other) {
+        items = std::move(other.items);
+        keys = std::move(other.keys);
+        handles = std::move(other.handles);
+        slots = std::move(other.slots);
+        index = std::move(other.index);
+        handleBase = other.handleBase;
+    }
+    
+    std::vector<T> items;                                   // Dense storage
+    std::vector<Engine::StringId> keys;                     // ID of each item
+    std::vector<Handle> handles;                            // Handle of each item
+    std::vector<uint32_t> slots;                            // Handle - handleBase to slot (INVALID_HANDLE once removed)
+    std::unordered_map<Engine::StringId, Handle> index;     // ID to handle
+    Handle handleBase = 0;                                  // Handles issued before the last Clear or full load
+    ContentLoadStats lastLoadStats;
 };
 
 } // namespace Game 
\ No newline at end of file
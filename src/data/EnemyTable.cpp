@@ -0,0 +1,59 @@
+#include "EnemyTable.h"
+#include <iostream>
+
+namespace Game {
+
+EnemyTable& EnemyTable::GetInstance() {
+    static EnemyTable table;
+    return table;
+}
+
+bool EnemyTable::LoadFromFile(const std::string& filePath) {
+    if (!enemies.LoadFromFile(filePath)) {
+        return false;
+    }
+
+    BuildSpawnTables();
+    std::cout << "Loaded " << enemies.GetItemCount() << " enemies from " << filePath << std::endl;
+    return true;
+}
+
+bool EnemyTable::Load(const ContentPack& pack) {
+    enemies.LoadFromRecords(pack, pack.GetEnemies(), pack.GetEnemyCount());
+
+    BuildSpawnTables();
+    std::cout << "Loaded " << enemies.GetItemCount() << " enemies from content pack" << std::endl;
+    return true;
+}
+
+int EnemyTable::GetTier(int difficulty) {
+    // Same bands as the combat encounter descriptions
+    if (difficulty <= 1) return 0;
+    if (difficulty <= 3) return 1;
+    if (difficulty <= 5) return 2;
+    return 3;
+}
+
+const EnemyData* EnemyTable::Pick(int difficulty, std::mt19937& gen) const {
+    const Engine::AliasTable& table = spawnTables[GetTier(difficulty)];
+    if (table.IsEmpty()) {
+        return nullptr;
+    }
+    return &enemies.GetItems()[table.Sample(gen)];
+}
+
+void EnemyTable::BuildSpawnTables() {
+    const std::vector<EnemyData>& archetypes = enemies.GetItems();
+    std::vector<double> weights(archetypes.size());
+
+    for (int tier = 0; tier < TIER_COUNT; ++tier) {
+        for (size_t i = 0; i < archetypes.size(); ++i) {
+            weights[i] = archetypes[i].GetSpawnWeight(tier);
+        }
+        if (!spawnTables[tier].Build(weights) && !archetypes.empty()) {
+            std::cerr << "Warning: no enemy can spawn in difficulty tier " << tier << std::endl;
+        }
+    }
+}
+
+} // namespace Game 
\ No newline at end of file
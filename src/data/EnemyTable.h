@@ -0,0 +1,47 @@
+#pragma once
+
+#include "schemas/EnemyData.h"
+#include "../engine/core/AliasTable.h"
+#include <random>
+#include <string>
+
+namespace Game {
+
+// Enemy archetypes plus one precomputed spawn table per difficulty tier.
+//
+// The table is rebuilt whenever the archetypes are loaded; picking an enemy
+// is then a single O(1) alias-table draw, however many archetypes the
+// content defines. Reading is safe from any thread once loading is done.
+class EnemyTable {
+public:
+    static constexpr int TIER_COUNT = static_cast<int>(EnemyData::TIER_COUNT);
+
+    static EnemyTable& GetInstance();
+
+    // Load archetypes from enemies.json
+    bool LoadFromFile(const std::string& filePath);
+
+    // Load archetypes from a compiled content pack (no JSON parsing)
+    bool Load(const ContentPack& pack);
+
+    // Spawn tier of an encounter difficulty (0 to TIER_COUNT - 1)
+    static int GetTier(int difficulty);
+
+    // Weighted random archetype for a difficulty; nullptr if nothing can
+    // spawn in its tier
+    const EnemyData* Pick(int difficulty, std::mt19937& gen) const;
+
+    const EnemyLoader& GetEnemies() const { return enemies; }
+    size_t GetEnemyCount() const { return enemies.GetItemCount(); }
+
+private:
+    EnemyTable() = default;
+
+    // Rebuild every tier's alias table over the loaded archetypes
+    void BuildSpawnTables();
+
+    EnemyLoader enemies;
+    Engine::AliasTable spawnTables[TIER_COUNT];  // Sample a slot of enemies.GetItems()
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "JsonEntryStream.h"
+#include <iostream>
+#include <utility>
+
+namespace Game {
+
+JsonEntryStream::JsonEntryStream(EntryCallback callback)
+    : callback(std::move(callback)),
+      depth(0),
+      entryCount(0),
+      failed(false) {
+}
+
+bool JsonEntryStream::Parse(std::istream& input, const std::string& name) {
+    sourceName = name;
+    depth = 0;
+    open.clear();
+    entryCount = 0;
+    failed = false;
+
+    bool parsed = nlohmann::json::sax_parse(input, this);
+    return parsed && !failed;
+}
+
+bool JsonEntryStream::AddValue(nlohmann::json&& value) {
+    if (depth == 0) {
+        // Anything other than an object at the top level
+        std::cerr << "Error loading " << sourceName << ": expected an object keyed by ID" << std::endl;
+        failed = true;
+        return false;
+    }
+
+    bool container = value.is_object() || value.is_array();
+
+    nlohmann::json* slot = nullptr;
+    if (open.empty()) {
+        // A new top-level entry
+        entry = std::move(value);
+        slot = &entry;
+    } else if (open.back()->is_object()) {
+        slot = &(*open.back())[pendingKey];
+        *slot = std::move(value);
+    } else {
+        open.back()->push_back(std::move(value));
+        slot = &open.back()->back();
+    }
+
+    if (container) {
+        open.push_back(slot);
+    } else if (open.empty()) {
+        FinishEntry();
+    }
+    return true;
+}
+
+void JsonEntryStream::FinishEntry() {
+    callback(entryKey, entry);
+    entry = nullptr;
+    entryCount++;
+}
+
+bool JsonEntryStream::null() {
+    return AddValue(nullptr);
+}
+
+bool JsonEntryStream::boolean(bool value) {
+    return AddValue(value);
+}
+
+bool JsonEntryStream::number_integer(number_integer_t value) {
+    return AddValue(value);
+}
+
+bool JsonEntryStream::number_unsigned(number_unsigned_t value) {
+    return AddValue(value);
+}
+
+bool JsonEntryStream::number_float(number_float_t value, const string_t& /*text*/) {
+    return AddValue(value);
+}
+
+bool JsonEntryStream::string(string_t& value) {
+    return AddValue(std::move(value));
+}
+
+bool JsonEntryStream::binary(binary_t& value) {
+    return AddValue(nlohmann::json::binary(std::move(value)));
+}
+
+bool JsonEntryStream::start_object(std::size_t /*elements*/) {
+    if (depth++ == 0) {
+        // The top-level object itself is never built
+        return true;
+    }
+    return AddValue(nlohmann::json::object());
+}
+
+bool JsonEntryStream::key(string_t& value) {
+    if (depth == 1) {
+        entryKey = std::move(value);
+    } else {
+        pendingKey = std::move(value);
+    }
+    return true;
+}
+
+bool JsonEntryStream::end_object() {
+    depth--;
+    if (depth == 0) {
+        return true;
+    }
+
+    open.pop_back();
+    if (open.empty()) {
+        FinishEntry();
+    }
+    return true;
+}
+
+bool JsonEntryStream::start_array(std::size_t /*elements*/) {
+    if (depth == 0) {
+        return AddValue(nlohmann::json::array());
+    }
+    depth++;
+    return AddValue(nlohmann::json::array());
+}
+
+bool JsonEntryStream::end_array() {
+    depth--;
+    open.pop_back();
+    if (open.empty()) {
+        FinishEntry();
+    }
+    return true;
+}
+
+bool JsonEntryStream::parse_error(std::size_t position, const std::string& /*lastToken*/,
+                                  const nlohmann::detail::exception& error) {
+    std::cerr << "Error loading " << sourceName << " at byte " << position << ": " << error.what() << std::endl;
+    failed = true;
+    return false;
+}
+
+} // namespace Game 
\ No newline at end of file
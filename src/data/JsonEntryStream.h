@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+#include "json.hpp"
+
+namespace Game {
+
+// Streams a JSON object of the form { "key": value, ... } one entry at a
+// time. The parser runs in SAX mode and only the entry being read is built
+// as a DOM, which is handed to the callback and dropped before the next
+// one starts, so memory stays bounded by the largest single entry rather
+// than by the size of the file.
+class JsonEntryStream : public nlohmann::json_sax<nlohmann::json> {
+public:
+    using EntryCallback = std::function<void(const std::string& key, const nlohmann::json& value)>;
+
+    explicit JsonEntryStream(EntryCallback callback);
+
+    // Parse a whole stream; returns false (and logs) on malformed input or
+    // if the top level is not an object. sourceName is only used in messages.
+    bool Parse(std::istream& input, const std::string& sourceName);
+
+    // Entries delivered so far
+    size_t GetEntryCount() const { return entryCount; }
+
+    // SAX events
+    bool null() override;
+    bool boolean(bool value) override;
+    bool number_integer(number_integer_t value) override;
+    bool number_unsigned(number_unsigned_t value) override;
+    bool number_float(number_float_t value, const string_t& text) override;
+    bool string(string_t& value) override;
+    bool binary(binary_t& value) override;
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& value) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, const std::string& lastToken,
+                     const nlohmann::detail::exception& error) override;
+
+private:
+    // Add a value to the entry being built; containers become the new top
+    bool AddValue(nlohmann::json&& value);
+    void FinishEntry();
+
+    EntryCallback callback;
+    std::string sourceName;
+    int depth;                              // 0 = outside the top-level object
+    std::string entryKey;
+    nlohmann::json entry;
+    std::vector<nlohmann::json*> open;      // Containers of the entry still being filled
+    std::string pendingKey;
+    size_t entryCount;
+    bool failed;
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "LootTables.h"
+#include <iostream>
+
+namespace Game {
+
+LootTables& LootTables::GetInstance() {
+    static LootTables lootTables;
+    return lootTables;
+}
+
+bool LootTables::LoadFromFile(const std::string& filePath) {
+    LootTableLoader loader;
+    if (!loader.LoadFromFile(filePath)) {
+        return false;
+    }
+
+    Build(loader);
+    std::cout << "Loaded " << tables.size() << " loot tables from " << filePath << std::endl;
+    return true;
+}
+
+bool LootTables::Load(const ContentPack& pack) {
+    LootTableLoader loader;
+    loader.LoadFromRecords(pack, pack.GetLootTables(), pack.GetLootTableCount());
+
+    Build(loader);
+    std::cout << "Loaded " << tables.size() << " loot tables from content pack" << std::endl;
+    return true;
+}
+
+int LootTables::GetTier(int quality) {
+    // Same bands as the treasure encounter descriptions
+    if (quality <= 1) return 0;
+    if (quality <= 3) return 1;
+    if (quality <= 5) return 2;
+    return 3;
+}
+
+bool LootTables::Roll(Engine::StringId table, int quality, std::mt19937& gen, std::vector<LootDrop>& drops) const {
+    auto it = tableIndex.find(table);
+    if (it == tableIndex.end()) {
+        return false;
+    }
+
+    RollTable(tables[it->second], GetTier(quality), gen, drops, 0);
+    return true;
+}
+
+void LootTables::Build(const LootTableLoader& loader) {
+    Engine::StringInterner& interner = Engine::StringInterner::GetInstance();
+    const std::vector<LootTableData>& sources = loader.GetItems();
+    const std::vector<Engine::StringId>& keys = loader.GetKeys();
+
+    tableIndex.clear();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        tableIndex[keys[i]] = static_cast<uint32_t>(i);
+    }
+
+    tables.clear();
+    tables.resize(sources.size());
+    std::vector<double> weights;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        Table& table = tables[i];
+        const std::vector<LootTableData::Entry>& sourceEntries = sources[i].GetEntries();
+
+        for (const LootTableData::Entry& source : sourceEntries) {
+            Entry entry = {source.target, NO_TABLE, source.minCount, source.maxCount};
+            if (source.isTable) {
+                auto found = tableIndex.find(source.target);
+                if (found == tableIndex.end()) {
+                    std::cerr << "Loot table " << interner.Get(keys[i]) << " refers to unknown table "
+                              << interner.Get(source.target) << std::endl;
+                    continue;
+                }
+                entry.table = found->second;
+            }
+            table.entries.push_back(entry);
+        }
+
+        // Weights follow the surviving entries
+        for (int tier = 0; tier < TIER_COUNT; ++tier) {
+            weights.clear();
+            for (const LootTableData::Entry& source : sourceEntries) {
+                if (!source.isTable || tableIndex.count(source.target) > 0) {
+                    weights.push_back(source.weights[tier]);
+                }
+            }
+            table.tiers[tier].Build(weights);
+        }
+    }
+}
+
+void LootTables::RollTable(const Table& table, int tier, std::mt19937& gen, std::vector<LootDrop>& drops,
+                           int depth) const {
+    const Engine::AliasTable& alias = table.tiers[tier];
+    if (alias.IsEmpty()) {
+        return;
+    }
+
+    const Entry& entry = table.entries[alias.Sample(gen)];
+    int count = entry.minCount;
+    if (entry.maxCount > entry.minCount) {
+        // Raw draw, like the alias table, so a seed rolls the same loot everywhere
+        const uint64_t span = static_cast<uint64_t>(entry.maxCount - entry.minCount) + 1;
+        count += static_cast<int>((static_cast<uint64_t>(gen()) * span) >> 32);
+    }
+
+    if (entry.table == NO_TABLE) {
+        if (count > 0) {
+            drops.push_back({entry.itemId, count});
+        }
+        return;
+    }
+
+    if (depth >= MAX_DEPTH) {
+        std::cerr << "Loot table nesting deeper than " << MAX_DEPTH << "; roll dropped" << std::endl;
+        return;
+    }
+    for (int i = 0; i < count; ++i) {
+        RollTable(tables[entry.table], tier, gen, drops, depth + 1);
+    }
+}
+
+} // namespace Game 
\ No newline at end of file
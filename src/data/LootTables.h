@@ -0,0 +1,74 @@
+#pragma once
+
+#include "schemas/LootTableData.h"
+#include "../engine/core/AliasTable.h"
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Game {
+
+// Items produced by a loot roll, as content IDs into items.json
+struct LootDrop {
+    Engine::StringId itemId;
+    int count;
+};
+
+// Loot tables from loot.json, each compiled to one alias table per quality
+// tier when loaded.
+//
+// A roll walks the table graph with one O(1) draw per table visited and
+// only appends IDs and counts, so rolling the loot for a whole floor does
+// no allocation beyond the output vector and touches no strings. Reading
+// is safe from any thread once loading is done.
+class LootTables {
+public:
+    static constexpr int TIER_COUNT = static_cast<int>(LootTableData::TIER_COUNT);
+
+    static LootTables& GetInstance();
+
+    // Load tables from loot.json
+    bool LoadFromFile(const std::string& filePath);
+
+    // Load tables from a compiled content pack (no JSON parsing)
+    bool Load(const ContentPack& pack);
+
+    // Loot tier of a treasure quality (0 to TIER_COUNT - 1)
+    static int GetTier(int quality);
+
+    // Roll once on a table, appending its drops; returns false if there is
+    // no such table
+    bool Roll(Engine::StringId table, int quality, std::mt19937& gen, std::vector<LootDrop>& drops) const;
+
+    bool HasTable(Engine::StringId table) const { return tableIndex.count(table) > 0; }
+    size_t GetTableCount() const { return tables.size(); }
+
+private:
+    LootTables() = default;
+
+    // Nested tables deeper than this are assumed to be a cycle and dropped
+    static constexpr int MAX_DEPTH = 8;
+    static constexpr uint32_t NO_TABLE = UINT32_MAX;
+
+    struct Entry {
+        Engine::StringId itemId;
+        uint32_t table;             // Index into tables, or NO_TABLE for an item
+        int minCount;
+        int maxCount;
+    };
+
+    struct Table {
+        std::vector<Entry> entries;
+        Engine::AliasTable tiers[TIER_COUNT];   // Sample an index into entries
+    };
+
+    // Resolve table references and build the alias tables
+    void Build(const LootTableLoader& loader);
+    void RollTable(const Table& table, int tier, std::mt19937& gen, std::vector<LootDrop>& drops, int depth) const;
+
+    std::vector<Table> tables;
+    std::unordered_map<Engine::StringId, uint32_t> tableIndex;
+};
+
+} // namespace Game 
\ No newline at end of file
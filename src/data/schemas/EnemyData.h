@@ -0,0 +1,131 @@
+#pragma once
+
+#include "../DataLoader.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Game {
+
+// Data class for enemy archetypes (enemies.json)
+//
+// Every stat starts at 5 + level plus the archetype's offset. A positive
+// health overrides Constitution so the enemy has health + healthPerLevel *
+// level hit points. spawnWeights gives the relative chance of the archetype
+// in each difficulty tier (see EnemyTable); 0 keeps it out of that tier.
+class EnemyData : public JsonSerializable {
+public:
+    static constexpr size_t STAT_COUNT = 7;
+    static constexpr size_t TIER_COUNT = ContentPack::ENEMY_TIERS;
+
+    // JSON keys of the stat offsets, in StatType order
+    static constexpr const char* STAT_KEYS[STAT_COUNT] = {"str", "int", "spd", "dex", "con", "def", "lck"};
+
+    EnemyData() { spawnWeights.fill(1); }
+
+    // Getters
+    const std::string& GetName() const { return name; }
+    int GetStatOffset(size_t stat) const { return statOffsets[stat]; }
+    int GetHealth() const { return health; }
+    int GetHealthPerLevel() const { return healthPerLevel; }
+    const std::vector<Engine::StringId>& GetActions() const { return actions; }
+    uint32_t GetSpawnWeight(size_t tier) const { return spawnWeights[tier]; }
+
+    // Setters
+    void SetName(const std::string& value) { name = value; }
+    void SetStatOffset(size_t stat, int value) { statOffsets[stat] = value; }
+    void SetHealth(int value, int perLevel) { health = value; healthPerLevel = perLevel; }
+    void AddAction(std::string_view actionId) { actions.push_back(Engine::StringInterner::GetInstance().Intern(actionId)); }
+    void SetSpawnWeight(size_t tier, uint32_t weight) { spawnWeights[tier] = weight; }
+
+    // Load from JSON
+    void FromJson(const json& data) override {
+        name = data.value("name", "Enemy");
+
+        statOffsets.fill(0);
+        if (data.contains("stats")) {
+            const auto& stats = data["stats"];
+            for (size_t i = 0; i < STAT_COUNT; ++i) {
+                statOffsets[i] = stats.value(STAT_KEYS[i], 0);
+            }
+        }
+
+        health = data.value("health", 0);
+        healthPerLevel = data.value("healthPerLevel", 0);
+
+        actions.clear();
+        if (data.contains("actions")) {
+            for (const auto& actionId : data["actions"]) {
+                AddAction(actionId.get<std::string>());
+            }
+        }
+
+        spawnWeights.fill(1);
+        if (data.contains("spawnWeights")) {
+            const auto& weights = data["spawnWeights"];
+            for (size_t tier = 0; tier < TIER_COUNT && tier < weights.size(); ++tier) {
+                spawnWeights[tier] = weights[tier].get<uint32_t>();
+            }
+        }
+    }
+
+    // Load from a compiled content pack record
+    void FromRecord(const ContentPack& pack, const ContentPack::EnemyRecord& record) {
+        name = pack.GetString(record.name);
+        for (size_t i = 0; i < STAT_COUNT; ++i) {
+            statOffsets[i] = record.statOffsets[i];
+        }
+        health = record.health;
+        healthPerLevel = record.healthPerLevel;
+
+        actions.clear();
+        const ContentPack::StringRef* actionIds = pack.GetEnemyActions(record);
+        for (uint32_t i = 0; i < record.actionCount; ++i) {
+            AddAction(pack.GetString(actionIds[i]));
+        }
+
+        for (size_t tier = 0; tier < TIER_COUNT; ++tier) {
+            spawnWeights[tier] = record.spawnWeights[tier];
+        }
+    }
+
+    // Convert to JSON
+    json ToJson() const override {
+        json data;
+
+        data["name"] = name;
+
+        // Only include non-zero stat offsets
+        json stats = json::object();
+        for (size_t i = 0; i < STAT_COUNT; ++i) {
+            if (statOffsets[i] != 0) stats[STAT_KEYS[i]] = statOffsets[i];
+        }
+        data["stats"] = stats;
+
+        data["health"] = health;
+        data["healthPerLevel"] = healthPerLevel;
+
+        json actionIds = json::array();
+        for (Engine::StringId actionId : actions) {
+            actionIds.push_back(Engine::StringInterner::GetInstance().Get(actionId));
+        }
+        data["actions"] = actionIds;
+        data["spawnWeights"] = spawnWeights;
+
+        return data;
+    }
+
+private:
+    std::string name;
+    std::array<int, STAT_COUNT> statOffsets = {};
+    int health = 0;
+    int healthPerLevel = 0;
+    std::vector<Engine::StringId> actions;      // Interned action IDs
+    std::array<uint32_t, TIER_COUNT> spawnWeights;
+};
+
+// Type alias for a loader that handles EnemyData
+using EnemyLoader = DataLoader<EnemyData>;
+
+} // namespace Game 
\ No newline at end of file
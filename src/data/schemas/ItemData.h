@@ -56,6 +56,21 @@ public:
         }
     }
     
+    // Load from a compiled content pack record
+    void FromRecord(const ContentPack& pack, const ContentPack::ItemRecord& record) {
+        name = pack.GetString(record.name);
+        description = pack.GetString(record.description);
+        value = record.value;
+        weight = record.weight;
+        equippable = record.equippable != 0;
+        equipSlot = pack.GetString(record.equipSlot);
+        strBonus = record.strBonus;
+        dexBonus = record.dexBonus;
+        conBonus = record.conBonus;
+        intBonus = record.intBonus;
+        spdBonus = record.spdBonus;
+    }
+    
     // Convert to JSON
     json ToJson() const override {
         json data;
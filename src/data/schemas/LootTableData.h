@@ -0,0 +1,114 @@
+#pragma once
+
+#include "../DataLoader.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Game {
+
+// Data class for loot tables (loot.json)
+//
+// A roll on a table picks one entry by its weight in the roll's quality
+// tier. An "item" entry drops count copies of an items.json item; a
+// "table" entry rolls count times on another table at the same tier.
+// count is either a number or a [min, max] range and defaults to 1.
+class LootTableData : public JsonSerializable {
+public:
+    static constexpr size_t TIER_COUNT = ContentPack::LOOT_TIERS;
+
+    struct Entry {
+        Engine::StringId target = Engine::StringInterner::EMPTY;   // Item ID or table ID
+        bool isTable = false;
+        int minCount = 1;
+        int maxCount = 1;
+        std::array<uint32_t, TIER_COUNT> weights = {};
+    };
+
+    LootTableData() = default;
+
+    const std::vector<Entry>& GetEntries() const { return entries; }
+
+    // Load from JSON
+    void FromJson(const json& data) override {
+        entries.clear();
+        if (!data.contains("entries")) {
+            return;
+        }
+
+        Engine::StringInterner& interner = Engine::StringInterner::GetInstance();
+        for (const auto& entryData : data["entries"]) {
+            Entry entry;
+            entry.isTable = entryData.contains("table");
+            entry.target = interner.Intern(entryData.value(entry.isTable ? "table" : "item", ""));
+
+            if (entryData.contains("count")) {
+                const auto& count = entryData["count"];
+                if (count.is_array() && count.size() == 2) {
+                    entry.minCount = count[0].get<int>();
+                    entry.maxCount = count[1].get<int>();
+                } else if (count.is_number_integer()) {
+                    entry.minCount = entry.maxCount = count.get<int>();
+                }
+            }
+
+            entry.weights.fill(1);
+            if (entryData.contains("weights")) {
+                const auto& weights = entryData["weights"];
+                for (size_t tier = 0; tier < TIER_COUNT && tier < weights.size(); ++tier) {
+                    entry.weights[tier] = weights[tier].get<uint32_t>();
+                }
+            }
+
+            entries.push_back(entry);
+        }
+    }
+
+    // Load from a compiled content pack record
+    void FromRecord(const ContentPack& pack, const ContentPack::LootTableRecord& record) {
+        Engine::StringInterner& interner = Engine::StringInterner::GetInstance();
+        const ContentPack::LootEntryRecord* records = pack.GetLootEntries(record);
+
+        entries.resize(record.entryCount);
+        for (uint32_t i = 0; i < record.entryCount; ++i) {
+            Entry& entry = entries[i];
+            entry.target = interner.Intern(pack.GetString(records[i].target));
+            entry.isTable = records[i].isTable != 0;
+            entry.minCount = records[i].minCount;
+            entry.maxCount = records[i].maxCount;
+            for (size_t tier = 0; tier < TIER_COUNT; ++tier) {
+                entry.weights[tier] = records[i].weights[tier];
+            }
+        }
+    }
+
+    // Convert to JSON
+    json ToJson() const override {
+        Engine::StringInterner& interner = Engine::StringInterner::GetInstance();
+
+        json entryList = json::array();
+        for (const Entry& entry : entries) {
+            json entryData;
+            entryData[entry.isTable ? "table" : "item"] = interner.Get(entry.target);
+            if (entry.minCount != entry.maxCount) {
+                entryData["count"] = {entry.minCount, entry.maxCount};
+            } else if (entry.minCount != 1) {
+                entryData["count"] = entry.minCount;
+            }
+            entryData["weights"] = entry.weights;
+            entryList.push_back(entryData);
+        }
+
+        json data;
+        data["entries"] = entryList;
+        return data;
+    }
+
+private:
+    std::vector<Entry> entries;
+};
+
+// Type alias for a loader that handles LootTableData
+using LootTableLoader = DataLoader<LootTableData>;
+
+} // namespace Game 
\ No newline at end of file
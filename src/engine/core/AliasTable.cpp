@@ -0,0 +1,85 @@
+#include "AliasTable.h"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+
+constexpr uint64_t ONE = 1ULL << 32;
+
+} // namespace
+
+bool AliasTable::Build(const std::vector<double>& weights) {
+    Clear();
+
+    double total = 0.0;
+    for (double weight : weights) {
+        if (weight > 0.0) {
+            total += weight;
+        }
+    }
+    if (total <= 0.0 || weights.size() > UINT32_MAX) {
+        return false;
+    }
+
+    // Vose's method: scale so the average weight is 1, then repeatedly top
+    // up an under-full column with the excess of an over-full one
+    const size_t count = weights.size();
+    std::vector<double> scaled(count);
+    std::vector<uint32_t> small;
+    std::vector<uint32_t> large;
+    for (size_t i = 0; i < count; ++i) {
+        scaled[i] = weights[i] > 0.0 ? weights[i] * count / total : 0.0;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+
+    threshold.assign(count, ONE);
+    alias.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        alias[i] = static_cast<uint32_t>(i);
+    }
+
+    while (!small.empty() && !large.empty()) {
+        uint32_t under = small.back();
+        small.pop_back();
+        uint32_t over = large.back();
+
+        threshold[under] = static_cast<uint64_t>(std::max(0.0, scaled[under]) * ONE);
+        alias[under] = over;
+
+        scaled[over] -= 1.0 - scaled[under];
+        if (scaled[over] < 1.0) {
+            large.pop_back();
+            small.push_back(over);
+        }
+    }
+
+    // Whatever is left is full up to rounding error. A zero-weight entry
+    // can only be left over through that error; it must never be picked,
+    // so it hands its whole column to a positive entry.
+    uint32_t positive = 0;
+    while (!(weights[positive] > 0.0)) {
+        positive++;
+    }
+    for (uint32_t column : small) {
+        if (weights[column] > 0.0) {
+            threshold[column] = ONE;
+        } else {
+            threshold[column] = 0;
+            alias[column] = positive;
+        }
+    }
+    return true;
+}
+
+size_t AliasTable::Sample(std::mt19937& gen) const {
+    const uint64_t column = (static_cast<uint64_t>(gen()) * alias.size()) >> 32;
+    return static_cast<uint64_t>(gen()) < threshold[column] ? column : alias[column];
+}
+
+void AliasTable::Clear() {
+    threshold.clear();
+    alias.clear();
+}
+
+} // namespace Engine 
\ No newline at end of file
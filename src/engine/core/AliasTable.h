@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace Engine {
+
+// Walker/Vose alias table for weighted random selection.
+//
+// Build is O(n) and done once per weight set; Sample is O(1) however many
+// entries there are: one draw picks a column, a second decides between the
+// column's own entry and its alias. Sampling uses raw 32-bit engine output
+// rather than std distributions, so a seed makes the same picks with every
+// standard library.
+class AliasTable {
+public:
+    AliasTable() = default;
+
+    // Build from non-negative weights; entries with weight 0 are never
+    // picked. Returns false (leaving the table empty) if no weight is positive.
+    bool Build(const std::vector<double>& weights);
+
+    // Index of a weighted random entry (the table must not be empty)
+    size_t Sample(std::mt19937& gen) const;
+
+    bool IsEmpty() const { return alias.empty(); }
+    size_t GetSize() const { return alias.size(); }
+    void Clear();
+
+private:
+    // Per column: keep the column's own entry if a draw is below threshold
+    // (out of 2^32), otherwise take its alias
+    std::vector<uint64_t> threshold;
+    std::vector<uint32_t> alias;
+};
+
+} // namespace Engine 
\ No newline at end of file
@@ -1,7 +1,10 @@
 #include "Application.h"
 #include "/opt/homebrew/include/raylib.h"
 #include <iostream>
+#include <cstdlib>
+#include <ctime>
 #include "../../game/states/DataTestState.h"
+#include "../../data/ContentPipeline.h"
 
 namespace Engine {
 
@@ -28,6 +31,13 @@ Application::~Application() {
 }
 
 bool Application::Initialize() {
+    // Seed std::rand for the block rolls and test screens that still use it
+    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    
+    // Load content packs on worker threads while the window is created;
+    // states that need content wait on the pipeline in Enter
+    Game::ContentPipeline::GetInstance().Start();
+    
     // Initialize renderer
     if (!renderer.Initialize()) {
         std::cerr << "Failed to initialize renderer!" << std::endl;
@@ -56,6 +66,9 @@ void Application::Run() {
         // Process input
         inputHandler.Update();
         
+        // Apply content edits before the frame uses them
+        fileWatcher.Poll();
+        
         // Update the current state
         stateManager.Update(gameTime.GetDeltaTime());
         
@@ -3,6 +3,7 @@
 #include <string>
 #include "StateManager.h"
 #include "GameTime.h"
+#include "FileWatcher.h"
 #include "../input/InputHandler.h"
 #include "../rendering/Renderer.h"
 
@@ -29,6 +30,9 @@ public:
     int GetScreenWidth() const;
     int GetScreenHeight() const;
     
+    // Content file watching (callbacks run between frames)
+    FileWatcher& GetFileWatcher() { return fileWatcher; }
+    
     // Singleton access
     static Application& GetInstance();
     
@@ -46,6 +50,7 @@ private:
     GameTime gameTime;
     InputHandler inputHandler;
     Renderer renderer;
+    FileWatcher fileWatcher;
     
     // Singleton instance
     static Application* instance;
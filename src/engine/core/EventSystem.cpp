@@ -23,7 +23,7 @@ EventSystem::~EventSystem() {
 }
 
 void EventSystem::Subscribe(EventType type, EventCallback callback) {
-    subscribers[type].push_back(callback);
+    subscribers[static_cast<size_t>(type)].push_back(callback);
 }
 
 void EventSystem::Unsubscribe(EventType type, EventCallback callback) {
@@ -36,13 +36,9 @@ void EventSystem::Unsubscribe(EventType type, EventCallback callback) {
 }
 
 void EventSystem::Publish(const Event& event) {
-    // Find subscribers for this event type
-    auto it = subscribers.find(event.type);
-    if (it != subscribers.end()) {
-        // Call each callback with the event
-        for (const auto& callback : it->second) {
-            callback(event);
-        }
+    // Call each subscriber for this event type with the event
+    for (const auto& callback : subscribers[static_cast<size_t>(event.type)]) {
+        callback(event);
     }
 }
 
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <array>
 #include <functional>
 #include <unordered_map>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <typeindex>
+#include <variant>
+#include "StringInterner.h"
 
 namespace Engine {
 
@@ -30,79 +34,204 @@ enum class EventType {
     ROOM_ENTERED
 };
 
-// Event data structure
+constexpr size_t EVENT_TYPE_COUNT = static_cast<size_t>(EventType::ROOM_ENTERED) + 1;
+
+// Typed event payloads, one per event type. They hold no owning strings,
+// so building and publishing a typed event never touches the heap. String
+// views point at the publisher's data and are only valid during Publish.
+struct WindowResizeEvent {
+    int width = 0;
+    int height = 0;
+};
+
+struct WindowCloseEvent {};
+
+// KEY_PRESSED and KEY_RELEASED
+struct KeyEvent {
+    int action = 0;             // InputAction
+    int keyCode = 0;
+};
+
+struct StateChangeEvent {
+    std::string_view stateName;
+};
+
+// An entity used a combat action, or the player team escaped
+struct PlayerMoveEvent {
+    std::string_view actionName;
+    std::string_view userName;
+    std::string_view targetName;
+    bool escaped = false;
+};
+
+struct CombatStartEvent {};
+
+struct HealthChangedEvent {
+    std::string_view entityName;
+    int health = 0;
+    int maxHealth = 0;
+};
+
+struct LevelUpEvent {
+    std::string_view entityName;
+    int level = 0;
+};
+
+struct RoomEnteredEvent {
+    int roomId = 0;
+};
+
+using EventPayload = std::variant<std::monostate, WindowResizeEvent, WindowCloseEvent, KeyEvent, StateChangeEvent,
+                                  PlayerMoveEvent, CombatStartEvent, HealthChangedEvent, LevelUpEvent,
+                                  RoomEnteredEvent>;
+
+// Event data structure. The fast path is the typed payload: construct the
+// event with one and read it back with Get<T>(). The key/value data below
+// is the slow path for ad-hoc payloads; its maps are only allocated once
+// something is set. Keys are interned; the string overloads intern (set)
+// or look up (get) the key, and the StringId overloads skip that for keys
+// the caller interned up front.
 class Event {
 public:
     Event(EventType type) : type(type) {}
     
+    template<typename Payload>
+    Event(EventType type, const Payload& payload) : type(type), payload(payload) {}
+    
+    // Typed payload, or nullptr if the event carries another kind
+    template<typename Payload>
+    const Payload* Get() const {
+        return std::get_if<Payload>(&payload);
+    }
+    
     // Add string data to event
-    void SetData(const std::string& key, const std::string& value) {
-        stringData[key] = value;
+    void SetData(std::string_view key, const std::string& value) {
+        SetData(StringInterner::GetInstance().Intern(key), value);
+    }
+    void SetData(StringId key, const std::string& value) {
+        GetKeyValueData().stringData[key] = value;
+    }
+    
+    // String literals are strings, not bools
+    void SetData(std::string_view key, const char* value) {
+        SetData(key, std::string(value));
+    }
+    void SetData(StringId key, const char* value) {
+        SetData(key, std::string(value));
     }
     
     // Add int data to event
-    void SetData(const std::string& key, int value) {
-        intData[key] = value;
+    void SetData(std::string_view key, int value) {
+        SetData(StringInterner::GetInstance().Intern(key), value);
+    }
+    void SetData(StringId key, int value) {
+        GetKeyValueData().intData[key] = value;
     }
     
     // Add float data to event
-    void SetData(const std::string& key, float value) {
-        floatData[key] = value;
+    void SetData(std::string_view key, float value) {
+        SetData(StringInterner::GetInstance().Intern(key), value);
+    }
+    void SetData(StringId key, float value) {
+        GetKeyValueData().floatData[key] = value;
     }
     
     // Add bool data to event
-    void SetData(const std::string& key, bool value) {
-        boolData[key] = value;
+    void SetData(std::string_view key, bool value) {
+        SetData(StringInterner::GetInstance().Intern(key), value);
+    }
+    void SetData(StringId key, bool value) {
+        GetKeyValueData().boolData[key] = value;
     }
     
     // Get string data from event
-    std::string GetStringData(const std::string& key, const std::string& defaultValue = "") const {
-        auto it = stringData.find(key);
-        return (it != stringData.end()) ? it->second : defaultValue;
+    std::string GetStringData(std::string_view key, const std::string& defaultValue = "") const {
+        StringId id;
+        return StringInterner::GetInstance().Find(key, id) ? GetStringData(id, defaultValue) : defaultValue;
+    }
+    std::string GetStringData(StringId key, const std::string& defaultValue = "") const {
+        if (!keyValueData) return defaultValue;
+        auto it = keyValueData->stringData.find(key);
+        return (it != keyValueData->stringData.end()) ? it->second : defaultValue;
     }
     
     // Get int data from event
-    int GetIntData(const std::string& key, int defaultValue = 0) const {
-        auto it = intData.find(key);
-        return (it != intData.end()) ? it->second : defaultValue;
+    int GetIntData(std::string_view key, int defaultValue = 0) const {
+        StringId id;
+        return StringInterner::GetInstance().Find(key, id) ? GetIntData(id, defaultValue) : defaultValue;
+    }
+    int GetIntData(StringId key, int defaultValue = 0) const {
+        if (!keyValueData) return defaultValue;
+        auto it = keyValueData->intData.find(key);
+        return (it != keyValueData->intData.end()) ? it->second : defaultValue;
     }
     
     // Get float data from event
-    float GetFloatData(const std::string& key, float defaultValue = 0.0f) const {
-        auto it = floatData.find(key);
-        return (it != floatData.end()) ? it->second : defaultValue;
+    float GetFloatData(std::string_view key, float defaultValue = 0.0f) const {
+        StringId id;
+        return StringInterner::GetInstance().Find(key, id) ? GetFloatData(id, defaultValue) : defaultValue;
+    }
+    float GetFloatData(StringId key, float defaultValue = 0.0f) const {
+        if (!keyValueData) return defaultValue;
+        auto it = keyValueData->floatData.find(key);
+        return (it != keyValueData->floatData.end()) ? it->second : defaultValue;
     }
     
     // Get bool data from event
-    bool GetBoolData(const std::string& key, bool defaultValue = false) const {
-        auto it = boolData.find(key);
-        return (it != boolData.end()) ? it->second : defaultValue;
+    bool GetBoolData(std::string_view key, bool defaultValue = false) const {
+        StringId id;
+        return StringInterner::GetInstance().Find(key, id) ? GetBoolData(id, defaultValue) : defaultValue;
+    }
+    bool GetBoolData(StringId key, bool defaultValue = false) const {
+        if (!keyValueData) return defaultValue;
+        auto it = keyValueData->boolData.find(key);
+        return (it != keyValueData->boolData.end()) ? it->second : defaultValue;
     }
     
     // Check if event has specific data key
-    bool HasStringData(const std::string& key) const {
-        return stringData.find(key) != stringData.end();
+    bool HasStringData(std::string_view key) const {
+        StringId id;
+        return keyValueData && StringInterner::GetInstance().Find(key, id) &&
+               keyValueData->stringData.find(id) != keyValueData->stringData.end();
     }
     
-    bool HasIntData(const std::string& key) const {
-        return intData.find(key) != intData.end();
+    bool HasIntData(std::string_view key) const {
+        StringId id;
+        return keyValueData && StringInterner::GetInstance().Find(key, id) &&
+               keyValueData->intData.find(id) != keyValueData->intData.end();
     }
     
-    bool HasFloatData(const std::string& key) const {
-        return floatData.find(key) != floatData.end();
+    bool HasFloatData(std::string_view key) const {
+        StringId id;
+        return keyValueData && StringInterner::GetInstance().Find(key, id) &&
+               keyValueData->floatData.find(id) != keyValueData->floatData.end();
     }
     
-    bool HasBoolData(const std::string& key) const {
-        return boolData.find(key) != boolData.end();
+    bool HasBoolData(std::string_view key) const {
+        StringId id;
+        return keyValueData && StringInterner::GetInstance().Find(key, id) &&
+               keyValueData->boolData.find(id) != keyValueData->boolData.end();
     }
     
     EventType type;
     
 private:
-    std::unordered_map<std::string, std::string> stringData;
-    std::unordered_map<std::string, int> intData;
-    std::unordered_map<std::string, float> floatData;
-    std::unordered_map<std::string, bool> boolData;
+    struct KeyValueData {
+        std::unordered_map<StringId, std::string> stringData;
+        std::unordered_map<StringId, int> intData;
+        std::unordered_map<StringId, float> floatData;
+        std::unordered_map<StringId, bool> boolData;
+    };
+    
+    KeyValueData& GetKeyValueData() {
+        if (!keyValueData) {
+            keyValueData = std::make_unique<KeyValueData>();
+        }
+        return *keyValueData;
+    }
+    
+    EventPayload payload;
+    std::unique_ptr<KeyValueData> keyValueData;     // Slow path, allocated on first SetData
 };
 
 // Event callback type
@@ -120,15 +249,15 @@ public:
     // Unsubscribe from an event type (not implemented yet)
     void Unsubscribe(EventType type, EventCallback callback);
     
-    // Publish an event
+    // Publish an event; calls the subscribers directly, without allocating
     void Publish(const Event& event);
     
     // Singleton access
     static EventSystem& GetInstance();
     
 private:
-    // Map of event types to list of callbacks
-    std::unordered_map<EventType, std::vector<EventCallback>> subscribers;
+    // Callbacks for each event type, indexed by EventType
+    std::array<std::vector<EventCallback>, EVENT_TYPE_COUNT> subscribers;
     
     // Singleton instance
     static EventSystem* instance;
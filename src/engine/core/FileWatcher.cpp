@@ -0,0 +1,177 @@
+#include "FileWatcher.h"
+#include <algorithm>
+#include <iostream>
+#include <system_error>
+
+#ifdef __linux__
+#include <cerrno>
+#include <climits>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Engine {
+
+namespace {
+
+// How often timestamps are compared when inotify is not available
+const std::chrono::milliseconds TIMESTAMP_POLL_INTERVAL(250);
+
+std::filesystem::file_time_type LastWriteTime(const std::filesystem::path& path) {
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(path, error);
+    return error ? std::filesystem::file_time_type::min() : time;
+}
+
+} // namespace
+
+FileWatcher::FileWatcher()
+    : notifyFd(-1),
+      nextId(0),
+      lastTimestampPoll(std::chrono::steady_clock::now()) {
+#ifdef __linux__
+    notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (notifyFd < 0) {
+        std::cerr << "inotify unavailable, polling watched files instead" << std::endl;
+    }
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+#ifdef __linux__
+    if (notifyFd >= 0) {
+        close(notifyFd);
+    }
+#endif
+}
+
+int FileWatcher::Watch(const std::string& filePath, Callback callback) {
+    std::error_code error;
+    std::filesystem::path path = std::filesystem::absolute(filePath, error).lexically_normal();
+    if (error || !std::filesystem::exists(path, error)) {
+        std::cerr << "Cannot watch missing file: " << filePath << std::endl;
+        return -1;
+    }
+
+    Watched entry;
+    entry.id = nextId++;
+    entry.path = path;
+    entry.directoryWatch = -1;
+    entry.lastWrite = LastWriteTime(path);
+    entry.callback = std::move(callback);
+
+#ifdef __linux__
+    if (notifyFd >= 0) {
+        // Adding the same directory again returns its existing descriptor
+        entry.directoryWatch = inotify_add_watch(notifyFd, path.parent_path().c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (entry.directoryWatch < 0) {
+            std::cerr << "Failed to watch " << path.parent_path() << ", polling " << filePath << " instead" << std::endl;
+        }
+    }
+#endif
+
+    watched.push_back(std::move(entry));
+    return watched.back().id;
+}
+
+void FileWatcher::Unwatch(int id) {
+    auto it = std::find_if(watched.begin(), watched.end(), [id](const Watched& entry) { return entry.id == id; });
+    if (it == watched.end()) {
+        return;
+    }
+
+    int directoryWatch = it->directoryWatch;
+    watched.erase(it);
+
+#ifdef __linux__
+    // The directory watch is shared by every file in that directory
+    bool stillUsed = std::any_of(watched.begin(), watched.end(), [directoryWatch](const Watched& entry) {
+        return entry.directoryWatch == directoryWatch;
+    });
+    if (directoryWatch >= 0 && !stillUsed) {
+        inotify_rm_watch(notifyFd, directoryWatch);
+    }
+#else
+    (void)directoryWatch;
+#endif
+}
+
+void FileWatcher::Poll() {
+    if (watched.empty()) {
+        return;
+    }
+
+    std::vector<int> changed;
+    PollNative(changed);
+    PollTimestamps(changed);
+
+    // Callbacks may watch or unwatch files, so look each one up again
+    for (int id : changed) {
+        auto it = std::find_if(watched.begin(), watched.end(), [id](const Watched& entry) { return entry.id == id; });
+        if (it == watched.end()) {
+            continue;
+        }
+
+        it->lastWrite = LastWriteTime(it->path);
+        Callback callback = it->callback;
+        std::string path = it->path.string();
+        callback(path);
+    }
+}
+
+void FileWatcher::PollNative(std::vector<int>& changed) {
+#ifdef __linux__
+    if (notifyFd < 0) {
+        return;
+    }
+
+    alignas(inotify_event) char buffer[16 * (sizeof(inotify_event) + NAME_MAX + 1)];
+    for (;;) {
+        ssize_t length = read(notifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (length < 0 && errno != EAGAIN && errno != EINTR) {
+                std::cerr << "Error reading file change events" << std::endl;
+            }
+            return;
+        }
+
+        for (ssize_t offset = 0; offset < length; ) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+            if (event->len == 0) {
+                continue;
+            }
+
+            for (const Watched& entry : watched) {
+                if (entry.directoryWatch == event->wd && entry.path.filename() == event->name &&
+                    std::find(changed.begin(), changed.end(), entry.id) == changed.end()) {
+                    changed.push_back(entry.id);
+                }
+            }
+        }
+    }
+#else
+    (void)changed;
+#endif
+}
+
+void FileWatcher::PollTimestamps(std::vector<int>& changed) {
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastTimestampPoll < TIMESTAMP_POLL_INTERVAL) {
+        return;
+    }
+    lastTimestampPoll = now;
+
+    for (const Watched& entry : watched) {
+        if (entry.directoryWatch >= 0) {
+            continue;
+        }
+
+        if (LastWriteTime(entry.path) != entry.lastWrite &&
+            std::find(changed.begin(), changed.end(), entry.id) == changed.end()) {
+            changed.push_back(entry.id);
+        }
+    }
+}
+
+} // namespace Engine 
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+// Watches files for changes and reports them from Poll, which the
+// application calls once per frame, so callbacks run between frames on the
+// main thread. On Linux changes come from inotify; elsewhere the watched
+// files' modification times are polled a few times per second.
+//
+// Directories are watched rather than the files themselves, because most
+// editors save by writing a new file and renaming it over the old one.
+// Every burst of writes to a file is reported once per Poll.
+class FileWatcher {
+public:
+    using Callback = std::function<void(const std::string& filePath)>;
+
+    FileWatcher();
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Call back whenever the file changes; returns an id for Unwatch (-1 on failure)
+    int Watch(const std::string& filePath, Callback callback);
+    void Unwatch(int id);
+
+    // Report changes since the last call (non-blocking)
+    void Poll();
+
+    // Whether changes come from the OS rather than from polling timestamps
+    bool IsNative() const { return notifyFd >= 0; }
+
+private:
+    struct Watched {
+        int id;
+        std::filesystem::path path;             // Absolute, normalised
+        int directoryWatch;                     // inotify watch descriptor (-1 when polling)
+        std::filesystem::file_time_type lastWrite;
+        Callback callback;
+    };
+
+    void PollNative(std::vector<int>& changed);
+    void PollTimestamps(std::vector<int>& changed);
+
+    int notifyFd;
+    int nextId;
+    std::vector<Watched> watched;
+    std::chrono::steady_clock::time_point lastTimestampPoll;
+};
+
+} // namespace Engine 
\ No newline at end of file
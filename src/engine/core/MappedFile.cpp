@@ -0,0 +1,81 @@
+#include "MappedFile.h"
+#include <iostream>
+#include <utility>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace Engine {
+
+MappedFile::MappedFile()
+    : data(nullptr), size(0), opened(false) {
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(std::exchange(other.data, nullptr)),
+      size(std::exchange(other.size, 0)),
+      opened(std::exchange(other.opened, false)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        opened = std::exchange(other.opened, false);
+    }
+    return *this;
+}
+
+bool MappedFile::Open(const std::string& filePath) {
+    Close();
+    
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Failed to open file: " << filePath << std::endl;
+        return false;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        std::cerr << "Failed to stat file: " << filePath << std::endl;
+        close(fd);
+        return false;
+    }
+    
+    size = static_cast<size_t>(info.st_size);
+    opened = true;
+    
+    // An empty file is valid but cannot be mapped
+    if (size > 0) {
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            std::cerr << "Failed to map file: " << filePath << std::endl;
+            close(fd);
+            size = 0;
+            opened = false;
+            return false;
+        }
+        data = mapping;
+    }
+    
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data != nullptr) {
+        munmap(data, size);
+    }
+    data = nullptr;
+    size = 0;
+    opened = false;
+}
+
+} // namespace Engine 
\ No newline at end of file
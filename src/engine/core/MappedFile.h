@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+namespace Engine {
+
+// Read-only memory mapping of a whole file. The mapping lives as long as
+// the object, so callers can read the file in place without copying it.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    
+    // Map a file; returns false (and logs) if it cannot be opened or mapped
+    bool Open(const std::string& filePath);
+    
+    // Unmap the file
+    void Close();
+    
+    bool IsOpen() const { return opened; }
+    const unsigned char* GetData() const { return static_cast<const unsigned char*>(data); }
+    size_t GetSize() const { return size; }
+    
+private:
+    void* data;
+    size_t size;
+    bool opened;
+};
+
+} // namespace Engine 
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "StringInterner.h"
+#include <mutex>
+
+namespace Engine {
+
+StringInterner& StringInterner::GetInstance() {
+    static StringInterner interner;
+    return interner;
+}
+
+StringInterner::StringInterner()
+    : textBytes(0) {
+    texts.emplace_back();
+    ids.emplace(texts.back(), EMPTY);
+}
+
+StringId StringInterner::Intern(std::string_view text) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(text);
+        if (it != ids.end()) {
+            return it->second;
+        }
+    }
+
+    // Another thread may have added the text between the two locks
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(text);
+    if (it != ids.end()) {
+        return it->second;
+    }
+
+    StringId id = static_cast<StringId>(texts.size());
+    texts.emplace_back(text);
+    ids.emplace(texts.back(), id);
+    textBytes += texts.back().capacity() + 1;
+    return id;
+}
+
+bool StringInterner::Find(std::string_view text, StringId& id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(text);
+    if (it == ids.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+const std::string& StringInterner::Get(StringId id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return id < texts.size() ? texts[id] : texts[EMPTY];
+}
+
+size_t StringInterner::GetCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return texts.size();
+}
+
+size_t StringInterner::GetMemoryUsage() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return texts.size() * sizeof(std::string) + ids.size() * (sizeof(std::string_view) + sizeof(StringId) + 2 * sizeof(void*)) +
+           ids.bucket_count() * sizeof(void*) + textBytes;
+}
+
+} // namespace Engine 
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Engine {
+
+// Stable 32-bit handle to an interned string; equal ids mean equal text
+using StringId = uint32_t;
+
+// Process-wide string interner.
+//
+// Content identifiers (action and item IDs, action property keys, status
+// effect names, room descriptions and properties, event payload keys) are
+// interned once when they are loaded or first used, and from then on are
+// stored, hashed and compared as StringIds. Get maps an id back to its text
+// in O(1) for display and logging.
+//
+// Each distinct string is stored once and never freed, so ids and the
+// references returned by Get stay valid for the life of the process.
+// Content loads and floors are generated on worker threads, so the table is
+// synchronised: interning takes a write lock only for strings it has not
+// seen before.
+class StringInterner {
+public:
+    // The empty string is always interned as id 0
+    static constexpr StringId EMPTY = 0;
+
+    static StringInterner& GetInstance();
+
+    // Id of a string, interning it on first use
+    StringId Intern(std::string_view text);
+
+    // Id of a string that is already interned, without adding it
+    bool Find(std::string_view text, StringId& id) const;
+
+    // Text of an id returned by Intern (the empty string for unknown ids)
+    const std::string& Get(StringId id) const;
+
+    // Statistics
+    size_t GetCount() const;
+    size_t GetMemoryUsage() const;
+
+private:
+    StringInterner();
+
+    mutable std::shared_mutex mutex;
+    std::deque<std::string> texts;                      // Indexed by id; deque keeps references stable
+    std::unordered_map<std::string_view, StringId> ids; // Views into texts
+    size_t textBytes;
+};
+
+} // namespace Engine 
\ No newline at end of file
@@ -4,7 +4,7 @@
 
 namespace Engine {
 
-// Initialize static member
+// Initialize static members
 InputHandler* InputHandler::instance = nullptr;
 
 InputHandler::InputHandler() : eventSystem(&EventSystem::GetInstance()) {
@@ -89,18 +89,14 @@ void InputHandler::ProcessKey(int keyCode, InputAction action) {
     // Check for key press
     if (IsKeyPressed(keyCode)) {
         // Create and publish key press event
-        Event event(EventType::KEY_PRESSED);
-        event.SetData("action", static_cast<int>(action));
-        event.SetData("key_code", keyCode);
+        Event event(EventType::KEY_PRESSED, KeyEvent{static_cast<int>(action), keyCode});
         eventSystem->Publish(event);
     }
     
     // Check for key release
     if (IsKeyReleased(keyCode)) {
         // Create and publish key release event
-        Event event(EventType::KEY_RELEASED);
-        event.SetData("action", static_cast<int>(action));
-        event.SetData("key_code", keyCode);
+        Event event(EventType::KEY_RELEASED, KeyEvent{static_cast<int>(action), keyCode});
         eventSystem->Publish(event);
     }
 }
@@ -1,316 +1,521 @@
 #include "Action.h"
 #include "Battlefield.h"
+#include "ResolutionEngine.h"
 #include "../entities/components/StatsComponent.h"
 #include "../entities/components/PositionComponent.h"
+#include "CombatLog.h"
 #include <iostream>
+#include <algorithm>
 #include <cstdlib>
-#include <ctime>
 
 namespace Game {
 
-//---------- ActionEffect Implementations ----------//
+//---------- Effect Compiler ----------//
 
-// DamageEffect implementation
-DamageEffect::DamageEffect(int baseDamage, bool isPhysical)
-    : damage(baseDamage), isPhysical(isPhysical) {
-}
+namespace {
 
-bool DamageEffect::Execute(Entity* user, Entity* target, Battlefield* battlefield) {
-    if (!user || !target) {
-        return false;
-    }
-    
-    // Get stats for damage calculation
-    if (!user->HasComponent<StatsComponent>() || !target->HasComponent<StatsComponent>()) {
-        std::cout << "Missing StatsComponent for damage calculation" << std::endl;
-        return false;
-    }
-    
-    auto& userStats = user->GetComponent<StatsComponent>();
-    auto& targetStats = target->GetComponent<StatsComponent>();
-    
-    // Calculate final damage
-    int finalDamage = damage;
-    
-    // Add STR bonus for physical attacks or INT bonus for magical attacks
-    if (isPhysical) {
-        finalDamage += userStats.GetCurrentStat(StatType::STRENGTH) / 2;
-    } else {
-        finalDamage += userStats.GetCurrentStat(StatType::INTELLECT) / 2;
-    }
-    
-    // Apply critical hit chance
-    int critChance = userStats.CalculateCriticalChance();
-    bool isCritical = (std::rand() % 100 + 1) <= critChance;
-    
-    if (isCritical) {
-        finalDamage *= 2;  // Double damage on critical hit
-        std::cout << "Critical hit!" << std::endl;
-    }
-    
-    // Apply damage to target
-    bool killed = targetStats.TakeDamage(finalDamage);
-    
-    std::cout << "Attack dealt " << finalDamage << " damage to " 
-              << target->GetName() << std::endl;
-    
-    if (killed) {
-        std::cout << target->GetName() << " was defeated!" << std::endl;
-    }
-    
-    return true;
+Engine::StringId InternKey(const char* key) {
+    return Engine::StringInterner::GetInstance().Intern(key);
 }
 
-bool DamageEffect::CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const {
-    if (!user || !target) {
-        return false;
-    }
-    
-    // Both need stats components
-    if (!user->HasComponent<StatsComponent>() || !target->HasComponent<StatsComponent>()) {
-        return false;
-    }
-    
-    // Can't attack self unless specifically allowed in the action properties
-    if (user == target) {
-        return false;
-    }
-    
-    return true;
-}
+// Property keys read by the compiler, interned once at startup
+const Engine::StringId SELF_ONLY_KEY = InternKey("self_only");
+const Engine::StringId CAN_TARGET_SELF_KEY = InternKey("can_target_self");
+const Engine::StringId POSITION_CHANGE_KEY = InternKey("position_change");
+const Engine::StringId DAMAGE_KEY = InternKey("damage");
+const Engine::StringId IS_PHYSICAL_KEY = InternKey("is_physical");
+const Engine::StringId DURATION_KEY = InternKey("duration");
+const Engine::StringId HEAL_AMOUNT_KEY = InternKey("heal_amount");
+
+// Stat modifier property keys
+struct StatModifierKey {
+    Engine::StringId key;
+    StatType stat;
+};
 
-// HealingEffect implementation
-HealingEffect::HealingEffect(int healAmount)
-    : amount(healAmount) {
+const StatModifierKey STAT_MODIFIER_KEYS[] = {
+    {InternKey("mod_STRENGTH"), StatType::STRENGTH},
+    {InternKey("mod_INTELLECT"), StatType::INTELLECT},
+    {InternKey("mod_SPEED"), StatType::SPEED},
+    {InternKey("mod_DEXTERITY"), StatType::DEXTERITY},
+    {InternKey("mod_CONSTITUTION"), StatType::CONSTITUTION},
+    {InternKey("mod_DEFENSE"), StatType::DEFENSE},
+    {InternKey("mod_LUCK"), StatType::LUCK}
+};
+
+EffectInstruction MakeInstruction(EffectOp op, EffectTarget target, int amount) {
+    EffectInstruction instruction{};
+    instruction.op = op;
+    instruction.target = target;
+    instruction.stat = StatType::STRENGTH;
+    instruction.isPhysical = false;
+    instruction.amount = amount;
+    instruction.duration = 0;
+    return instruction;
 }
 
-bool HealingEffect::Execute(Entity* user, Entity* target, Battlefield* battlefield) {
-    if (!target || !target->HasComponent<StatsComponent>()) {
-        return false;
-    }
+} // namespace
+
+void Action::Compile() {
+    program.clear();
     
-    auto& stats = target->GetComponent<StatsComponent>();
-    stats.Heal(amount);
+    // Resolve targeting flags
+    selfOnly = GetProperty(SELF_ONLY_KEY) > 0;
+    canTargetSelf = GetProperty(CAN_TARGET_SELF_KEY) > 0;
+    positionChange = GetProperty(POSITION_CHANGE_KEY);
     
-    std::cout << "Healed " << target->GetName() << " for " << amount << " HP" << std::endl;
-    return true;
-}
-
-bool HealingEffect::CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const {
-    if (!target || !target->HasComponent<StatsComponent>()) {
-        return false;
-    }
+    int damage = GetProperty(DAMAGE_KEY);
+    bool isPhysical = GetProperty(IS_PHYSICAL_KEY) > 0;
     
-    // Check if target is at full health
-    auto& stats = const_cast<Entity*>(target)->GetComponent<StatsComponent>();
-    if (stats.GetCurrentHealth() >= stats.GetMaxHealth()) {
-        std::cout << target->GetName() << " is already at full health." << std::endl;
-        return false;
+    // Duration shared by all stat modifiers (default 3 turns)
+    int duration = GetProperty(DURATION_KEY);
+    if (duration <= 0) duration = 3;
+    
+    // Based on the action type and properties, emit the matching instructions
+    switch (type) {
+        case ActionType::ATTACK: {
+            if (damage > 0) {
+                EffectInstruction instruction = MakeInstruction(EffectOp::DAMAGE, EffectTarget::TARGET, damage);
+                instruction.isPhysical = isPhysical;
+                program.push_back(instruction);
+            }
+            break;
+        }
+        
+        case ActionType::HEAL: {
+            // Reuse damage field for heal amount
+            if (damage > 0) {
+                program.push_back(MakeInstruction(EffectOp::HEAL, EffectTarget::TARGET, damage));
+            }
+            break;
+        }
+        
+        case ActionType::MOVEMENT: {
+            if (positionChange != 0) {
+                program.push_back(MakeInstruction(EffectOp::MOVE, EffectTarget::TARGET, positionChange));
+            }
+            break;
+        }
+        
+        case ActionType::BUFF:
+        case ActionType::DEBUFF: {
+            for (const auto& modifier : STAT_MODIFIER_KEYS) {
+                auto it = properties.find(modifier.key);
+                if (it == properties.end()) {
+                    continue;
+                }
+                
+                EffectInstruction instruction = MakeInstruction(EffectOp::MODIFY_STAT, EffectTarget::TARGET, it->second);
+                instruction.stat = modifier.stat;
+                instruction.duration = duration;
+                program.push_back(instruction);
+            }
+            break;
+        }
+        
+        case ActionType::COMPOUND: {
+            // Damage the target
+            if (damage > 0) {
+                EffectInstruction instruction = MakeInstruction(EffectOp::DAMAGE, EffectTarget::TARGET, damage);
+                instruction.isPhysical = isPhysical;
+                program.push_back(instruction);
+            }
+            
+            // For life drain, heal the user rather than the target
+            int healAmount = GetProperty(HEAL_AMOUNT_KEY);
+            if (healAmount > 0) {
+                program.push_back(MakeInstruction(EffectOp::HEAL, EffectTarget::USER, healAmount));
+            }
+            
+            // For charge, move the user rather than the target
+            if (positionChange != 0) {
+                program.push_back(MakeInstruction(EffectOp::MOVE, EffectTarget::USER, positionChange));
+            }
+            
+            // Buffs apply to the user, debuffs to the target
+            for (const auto& modifier : STAT_MODIFIER_KEYS) {
+                auto it = properties.find(modifier.key);
+                if (it == properties.end()) {
+                    continue;
+                }
+                
+                EffectTarget target = (it->second > 0) ? EffectTarget::USER : EffectTarget::TARGET;
+                EffectInstruction instruction = MakeInstruction(EffectOp::MODIFY_STAT, target, it->second);
+                instruction.stat = modifier.stat;
+                instruction.duration = duration;
+                program.push_back(instruction);
+            }
+            break;
+        }
+        
+        case ActionType::SPECIAL:
+        default:
+            // Special actions have no generic effects to compile
+            break;
     }
     
-    return true;
+    compiled = true;
 }
 
-// MovementEffect implementation
-MovementEffect::MovementEffect(int positionChange)
-    : positionChange(positionChange) {
-}
+//---------- Effect Interpreter ----------//
 
-bool MovementEffect::Execute(Entity* user, Entity* target, Battlefield* battlefield) {
-    if (!target || !battlefield || !target->HasComponent<PositionComponent>()) {
-        return false;
-    }
-    
-    auto& posComp = target->GetComponent<PositionComponent>();
-    int currentPos = posComp.GetPosition();
-    int newPos = currentPos + positionChange;
-    
-    // Try to move
-    if (battlefield->CanMoveTo(target, newPos)) {
-        battlefield->MoveEntity(target, newPos);
+bool Action::CanApply(const EffectInstruction& instruction, const Entity* user, 
+                      const Entity* target, const Battlefield* battlefield) const {
+    const Entity* subject = (instruction.target == EffectTarget::USER) ? user : target;
+    
+    switch (instruction.op) {
+        case EffectOp::DAMAGE: {
+            if (!user || !target) {
+                return false;
+            }
+            
+            // Both need stats components
+            if (!user->HasComponent<StatsComponent>() || !target->HasComponent<StatsComponent>()) {
+                return false;
+            }
+            
+            // Can't attack self
+            return user != target;
+        }
         
-        // Improved output message for clarity
-        std::string direction;
-        if (positionChange > 0) {
-            direction = "forward";
-        } else if (positionChange < 0) {
-            direction = "backward";
+        case EffectOp::HEAL: {
+            if (!subject || !subject->HasComponent<StatsComponent>()) {
+                return false;
+            }
+            
+            // Check if subject is at full health
+            auto& stats = const_cast<Entity*>(subject)->GetComponent<StatsComponent>();
+            if (stats.GetCurrentHealth() >= stats.GetMaxHealth()) {
+                CombatLog::Out() << subject->GetName() << " is already at full health." << std::endl;
+                return false;
+            }
+            return true;
         }
         
-        std::cout << target->GetName() << " moved " << direction << " to position " << newPos << std::endl;
-        return true;
-    } else {
-        // More informative error message
-        std::string reason;
-        if (!battlefield->IsValidPosition(newPos)) {
-            reason = "position is out of bounds";
-        } else if (battlefield->IsPositionOccupied(newPos)) {
-            reason = "position is already occupied";
-        } else {
-            reason = "movement is not possible";
+        case EffectOp::MOVE: {
+            if (!subject || !battlefield || !subject->HasComponent<PositionComponent>()) {
+                return false;
+            }
+            
+            // Check if the move is valid
+            int currentPos = const_cast<Entity*>(subject)->GetComponent<PositionComponent>().GetPosition();
+            int newPos = currentPos + instruction.amount;
+            return battlefield->IsValidPosition(newPos) && 
+                   battlefield->CanMoveTo(const_cast<Entity*>(subject), newPos);
         }
         
-        std::cout << "Cannot move to position " << newPos << ": " << reason << std::endl;
-        return false;
+        case EffectOp::MODIFY_STAT:
+            return subject && subject->HasComponent<StatsComponent>();
     }
+    
+    return false;
 }
 
-bool MovementEffect::CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const {
-    if (!target || !battlefield || !target->HasComponent<PositionComponent>()) {
-        return false;
-    }
+bool Action::Apply(const EffectInstruction& instruction, Entity* user, 
+                   Entity* target, Battlefield* battlefield, ResolutionEngine& resolution) const {
+    Entity* subject = (instruction.target == EffectTarget::USER) ? user : target;
     
-    // Calculate new position
-    int currentPos = const_cast<Entity*>(target)->GetComponent<PositionComponent>().GetPosition();
-    int newPos = currentPos + positionChange;
+    switch (instruction.op) {
+        case EffectOp::DAMAGE:
+            return ApplyDamage(instruction, user, {{target, 100}}, resolution);
+        
+        case EffectOp::HEAL: {
+            subject->GetComponent<StatsComponent>().Heal(instruction.amount);
+            
+            CombatLog::Out() << "Healed " << subject->GetName() << " for " << instruction.amount << " HP" << std::endl;
+            return true;
+        }
+        
+        case EffectOp::MOVE: {
+            int newPos = subject->GetComponent<PositionComponent>().GetPosition() + instruction.amount;
+            if (!battlefield->MoveEntity(subject, newPos)) {
+                return false;
+            }
+            
+            const char* direction = (instruction.amount > 0) ? "forward" : "backward";
+            CombatLog::Out() << subject->GetName() << " moved " << direction << " to position " << newPos << std::endl;
+            return true;
+        }
+        
+        case EffectOp::MODIFY_STAT: {
+            subject->GetComponent<StatsComponent>().AddModifier(instruction.stat, instruction.amount, instruction.duration);
+            
+            const char* effectType = (instruction.amount > 0) ? "buffed" : "debuffed";
+            CombatLog::Out() << subject->GetName() << "'s " << StatsComponent::GetStatName(instruction.stat) << " was " 
+                             << effectType << " by " << std::abs(instruction.amount) << " for " 
+                             << instruction.duration << " turns" << std::endl;
+            return true;
+        }
+    }
     
-    // Check if the move is valid
-    return battlefield->IsValidPosition(newPos) && 
-           battlefield->CanMoveTo(const_cast<Entity*>(target), newPos);
+    return false;
 }
 
-// StatModifierEffect implementation
-StatModifierEffect::StatModifierEffect(StatType statType, int value, int duration)
-    : statType(statType), value(value), duration(duration) {
+bool Action::ApplyToTargets(const EffectInstruction& instruction, Entity* user,
+                            const std::vector<AffectedTarget>& targets, Battlefield* battlefield,
+                            ResolutionEngine& resolution) const {
+    // Damage is resolved for the whole group at once
+    if (instruction.op == EffectOp::DAMAGE) {
+        return ApplyDamage(instruction, user, targets, resolution);
+    }
+    
+    bool anyApplied = false;
+    for (const auto& affected : targets) {
+        // Heals weaken on secondary targets just like damage does
+        EffectInstruction scaled = instruction;
+        if (scaled.op == EffectOp::HEAL && affected.scalePercent != 100) {
+            scaled.amount = std::max(1, scaled.amount * affected.scalePercent / 100);
+        }
+        
+        if (CanApply(scaled, user, affected.entity, battlefield) && 
+            Apply(scaled, user, affected.entity, battlefield, resolution)) {
+            anyApplied = true;
+        }
+    }
+    return anyApplied;
 }
 
-bool StatModifierEffect::Execute(Entity* user, Entity* target, Battlefield* battlefield) {
-    if (!target || !target->HasComponent<StatsComponent>()) {
+bool Action::ApplyDamage(const EffectInstruction& instruction, Entity* user,
+                         const std::vector<AffectedTarget>& targets, ResolutionEngine& resolution) const {
+    if (!user || !user->HasComponent<StatsComponent>()) {
         return false;
     }
     
-    auto& stats = target->GetComponent<StatsComponent>();
-    stats.AddModifier(statType, value, duration);
-    
-    std::string effectType = (value > 0) ? "buffed" : "debuffed";
-    std::string statName;
+    // User-side terms are the same for every target, so fetch them once
+    auto& userStats = user->GetComponent<StatsComponent>();
     
-    switch (statType) {
-        case StatType::STRENGTH: statName = "STRENGTH"; break;
-        case StatType::INTELLECT: statName = "INTELLECT"; break;
-        case StatType::SPEED: statName = "SPEED"; break;
-        case StatType::DEXTERITY: statName = "DEXTERITY"; break;
-        case StatType::CONSTITUTION: statName = "CONSTITUTION"; break;
-        case StatType::DEFENSE: statName = "DEFENSE"; break;
-        case StatType::LUCK: statName = "LUCK"; break;
+    // Add STR bonus for physical attacks or INT bonus for magical attacks
+    int baseDamage = instruction.amount;
+    if (instruction.isPhysical) {
+        baseDamage += userStats.GetCurrentStat(StatType::STRENGTH) / 2;
+    } else {
+        baseDamage += userStats.GetCurrentStat(StatType::INTELLECT) / 2;
     }
     
-    std::cout << target->GetName() << "'s " << statName << " was " 
-              << effectType << " by " << std::abs(value) << " for " 
-              << duration << " turns" << std::endl;
+    bool anyApplied = false;
+    for (const auto& affected : targets) {
+        Entity* target = affected.entity;
+        
+        // Can't attack self, and the target needs stats to take damage
+        if (!target || target == user || !target->HasComponent<StatsComponent>()) {
+            continue;
+        }
+        
+        int finalDamage = baseDamage;
+        if (affected.scalePercent != 100) {
+            finalDamage = std::max(1, baseDamage * affected.scalePercent / 100);
+        }
+        
+        // Crit and block come from the pair's outcome table in a single draw
+        auto& targetStats = target->GetComponent<StatsComponent>();
+        HitOutcome outcome = resolution.Resolve(userStats, targetStats);
+        anyApplied = true;
+        
+        if (outcome == HitOutcome::BLOCK) {
+            CombatLog::Out() << "Attack blocked!" << std::endl;
+            continue;
+        }
+        
+        if (outcome == HitOutcome::CRIT) {
+            finalDamage *= 2;  // Double damage on critical hit
+            CombatLog::Out() << "Critical hit!" << std::endl;
+        }
+        
+        // Apply the already-resolved damage to the target
+        bool killed = targetStats.ApplyDamage(finalDamage);
+        
+        CombatLog::Out() << "Attack dealt " << finalDamage << " damage to " 
+                         << target->GetName() << std::endl;
+        
+        if (killed) {
+            CombatLog::Out() << target->GetName() << " was defeated!" << std::endl;
+        }
+    }
     
-    return true;
+    return anyApplied;
 }
 
-bool StatModifierEffect::CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const {
-    return target && target->HasComponent<StatsComponent>();
+//---------- Target Collection ----------//
+
+void Action::CollectTargets(Entity* target, const Battlefield* battlefield,
+                            std::vector<AffectedTarget>& targets) const {
+    targets.clear();
+    if (!target) {
+        return;
+    }
+    targets.push_back({target, 100});
+    
+    // Area shapes need positions to work with
+    if (targetShape == TargetShape::SINGLE || !battlefield || 
+        !target->HasComponent<PositionComponent>()) {
+        return;
+    }
+    
+    // Areas never cross to the other side of the battlefield
+    int origin = target->GetComponent<PositionComponent>().GetPosition();
+    int half = Battlefield::MAX_TILES / 2;
+    int sideStart = (origin < half) ? 0 : half;
+    int sideEnd = sideStart + half - 1;
+    
+    // Living combatant standing on a tile, or null
+    auto combatantAt = [battlefield](int position) -> Entity* {
+        Entity* entity = battlefield->GetEntityAtPosition(position);
+        if (!entity || !entity->HasComponent<StatsComponent>() || 
+            entity->GetComponent<StatsComponent>().IsDead()) {
+            return nullptr;
+        }
+        return entity;
+    };
+    
+    switch (targetShape) {
+        case TargetShape::TILE_RANGE:
+        case TargetShape::SIDE: {
+            int first = sideStart;
+            int last = sideEnd;
+            if (targetShape == TargetShape::TILE_RANGE) {
+                first = std::max(sideStart, origin - area);
+                last = std::min(sideEnd, origin + area);
+            }
+            
+            for (int position = first; position <= last; ++position) {
+                Entity* entity = combatantAt(position);
+                if (entity && entity != target) {
+                    targets.push_back({entity, splashPercent});
+                }
+            }
+            break;
+        }
+        
+        case TargetShape::CHAIN: {
+            // Jump to the nearest combatant not yet hit, weakening each time
+            int current = origin;
+            int scale = 100;
+            for (int jump = 0; jump < area; ++jump) {
+                int bestPosition = -1;
+                for (int position = sideStart; position <= sideEnd; ++position) {
+                    Entity* entity = combatantAt(position);
+                    if (!entity) {
+                        continue;
+                    }
+                    
+                    bool alreadyHit = std::any_of(targets.begin(), targets.end(),
+                        [entity](const AffectedTarget& affected) { return affected.entity == entity; });
+                    if (alreadyHit) {
+                        continue;
+                    }
+                    
+                    if (bestPosition < 0 || std::abs(position - current) < std::abs(bestPosition - current)) {
+                        bestPosition = position;
+                    }
+                }
+                
+                if (bestPosition < 0) {
+                    break;
+                }
+                
+                scale = scale * splashPercent / 100;
+                targets.push_back({battlefield->GetEntityAtPosition(bestPosition), scale});
+                current = bestPosition;
+            }
+            break;
+        }
+        
+        case TargetShape::SINGLE:
+            break;
+    }
 }
 
 //---------- Action Implementation ----------//
 
 Action::Action(const std::string& id, const std::string& name, ActionType type)
-    : id(id), name(name), type(type) {
-    // Initialize random seed for accuracy checks
-    static bool seedInitialized = false;
-    if (!seedInitialized) {
-        std::srand(static_cast<unsigned int>(std::time(nullptr)));
-        seedInitialized = true;
-    }
+    : id(id), key(Engine::StringInterner::GetInstance().Intern(id)), name(name), type(type) {
+    // Rolls are made by the ResolutionEngine passed to Execute
 }
 
 Action::~Action() {
-    // Clear effects
-    effects.clear();
+    // Clear the compiled program
+    program.clear();
 }
 
-bool Action::Execute(Entity* user, Entity* target, Battlefield* battlefield) {
+ActionResult Action::Execute(Entity* user, Entity* target, Battlefield* battlefield,
+                             ResolutionEngine& resolution) const {
+    // Definitions are shared and immutable, so the loader must compile them up front
+    if (!compiled) {
+        CombatLog::Out() << "Action " << name << " has not been compiled." << std::endl;
+        return ActionResult::INVALID;
+    }
+    
     // Check if action can be used
     if (!CanUse(user, target, battlefield)) {
-        std::cout << "Action " << name << " cannot be used in this situation." << std::endl;
+        CombatLog::Out() << "Action " << name << " cannot be used in this situation." << std::endl;
         
         // For movement actions, provide more detail
         if (type == ActionType::MOVEMENT || 
-            (type == ActionType::COMPOUND && GetProperty("position_change") != 0)) {
+            (type == ActionType::COMPOUND && positionChange != 0)) {
             
             // Check battlefield conditions for movement
-            if (battlefield) {
-                int posChange = GetProperty("position_change");
+            if (battlefield && user && user->HasComponent<PositionComponent>()) {
+                int posChange = positionChange;
                 int currentPos = user->GetComponent<PositionComponent>().GetPosition();
                 int newPos = currentPos + posChange;
                 
                 if (!battlefield->IsValidPosition(newPos)) {
-                    std::cout << "  Reason: Movement would go out of bounds." << std::endl;
+                    CombatLog::Out() << "  Reason: Movement would go out of bounds." << std::endl;
                 } else if (battlefield->IsPositionOccupied(newPos)) {
                     Entity* blockingEntity = battlefield->GetEntityAtPosition(newPos);
-                    std::cout << "  Reason: Position " << newPos << " is occupied by " 
-                              << (blockingEntity ? blockingEntity->GetName() : "an entity") << "." << std::endl;
+                    CombatLog::Out() << "  Reason: Position " << newPos << " is occupied by " 
+                                     << (blockingEntity ? blockingEntity->GetName() : "an entity") << "." << std::endl;
                 }
             }
         }
         
-        return false;
+        return ActionResult::INVALID;
     }
     
     // Check for accuracy/hit chance
-    bool hit = true;
     if (accuracy < 100) {
-        int roll = std::rand() % 100 + 1; // 1-100
-        hit = (roll <= accuracy);
+        bool hit = resolution.RollAccuracy(accuracy);
         
         if (!hit) {
-            std::cout << "Action " << name << " missed!" << std::endl;
-            StartCooldown();
-            return false;
+            CombatLog::Out() << "Action " << name << " missed!" << std::endl;
+            return ActionResult::MISSED;
         }
     }
     
-    // If we don't have any effects, create them from properties
-    if (effects.empty()) {
-        CreateEffectsFromProperties();
+    // For compound actions, announce it's a combo
+    if (type == ActionType::COMPOUND && program.size() > 1) {
+        CombatLog::Out() << "-- " << name << " combo: " << program.size() << " effects --" << std::endl;
     }
     
-    // For compound actions, announce it's a combo
-    if (type == ActionType::COMPOUND && effects.size() > 1) {
-        std::cout << "-- " << name << " combo: " << effects.size() << " effects --" << std::endl;
+    // Gather everyone caught by the action once, up front
+    std::vector<AffectedTarget> targets;
+    CollectTargets(target, battlefield, targets);
+    if (targets.size() > 1) {
+        CombatLog::Out() << name << " hits " << targets.size() << " targets!" << std::endl;
     }
     
-    // Execute all effects
+    // Run the compiled effect program
     bool anyEffectExecuted = false;
-    for (auto& effect : effects) {
-        if (effect->CanApply(user, target, battlefield)) {
-            if (effect->Execute(user, target, battlefield)) {
+    for (const auto& instruction : program) {
+        if (instruction.target == EffectTarget::USER) {
+            if (CanApply(instruction, user, target, battlefield) && 
+                Apply(instruction, user, target, battlefield, resolution)) {
                 anyEffectExecuted = true;
             }
+        } else if (ApplyToTargets(instruction, user, targets, battlefield, resolution)) {
+            anyEffectExecuted = true;
         }
     }
     
-    // Handle the old effectCallback if present
-    if (effectCallback) {
-        effectCallback(user, target, battlefield);
-        anyEffectExecuted = true;
-    }
-    
-    // Apply cooldown if any effect was executed
-    if (anyEffectExecuted) {
-        StartCooldown();
-    }
-    
     // For compound actions, end the combo announcement
-    if (type == ActionType::COMPOUND && effects.size() > 1) {
-        std::cout << "-- End of " << name << " combo --" << std::endl;
+    if (type == ActionType::COMPOUND && program.size() > 1) {
+        CombatLog::Out() << "-- End of " << name << " combo --" << std::endl;
     }
     
-    return anyEffectExecuted;
+    return anyEffectExecuted ? ActionResult::EXECUTED : ActionResult::INVALID;
 }
 
 bool Action::CanUse(const Entity* user, const Entity* target, const Battlefield* battlefield) const {
-    // Check if action is on cooldown
-    if (IsOnCooldown()) {
-        std::cout << "Action " << name << " is on cooldown: " 
-                  << currentCooldown << " turns remaining." << std::endl;
-        return false;
-    }
-    
     // Check if both entities exist
     if (!user || !target) {
         return false;
@@ -339,8 +544,8 @@ bool Action::CanUse(const Entity* user, const Entity* target, const Battlefield*
         
         // Check if target is within range
         if (distance > range) {
-            std::cout << "Target is out of range. Required: " << range 
-                      << ", Actual: " << distance << std::endl;
+            CombatLog::Out() << "Target is out of range. Required: " << range 
+                             << ", Actual: " << distance << std::endl;
             return false;
         }
     }
@@ -351,8 +556,8 @@ bool Action::CanUse(const Entity* user, const Entity* target, const Battlefield*
     // Self-targeted actions like buffs
     if ((type == ActionType::BUFF || type == ActionType::HEAL) && !isSelfTargeted) {
         // Some buffs and heals require self-targeting
-        if (GetProperty("self_only") > 0) {
-            std::cout << "This action can only target the user." << std::endl;
+        if (selfOnly) {
+            CombatLog::Out() << "This action can only target the user." << std::endl;
             return false;
         }
     }
@@ -360,17 +565,17 @@ bool Action::CanUse(const Entity* user, const Entity* target, const Battlefield*
     // Enemy-targeted actions like attacks
     if ((type == ActionType::ATTACK || type == ActionType::DEBUFF) && isSelfTargeted) {
         // Can't attack or debuff self unless specifically allowed
-        if (GetProperty("can_target_self") <= 0) {
-            std::cout << "Cannot use this action on yourself." << std::endl;
+        if (!canTargetSelf) {
+            CombatLog::Out() << "Cannot use this action on yourself." << std::endl;
             return false;
         }
     }
     
     // If we have effects, check if at least one can be applied
-    if (!effects.empty()) {
+    if (!program.empty()) {
         bool anyEffectApplicable = false;
-        for (const auto& effect : effects) {
-            if (effect->CanApply(user, target, battlefield)) {
+        for (const auto& instruction : program) {
+            if (CanApply(instruction, user, target, battlefield)) {
                 anyEffectApplicable = true;
                 break;
             }
@@ -385,187 +590,11 @@ bool Action::CanUse(const Entity* user, const Entity* target, const Battlefield*
 }
 
 int Action::GetDamage() const {
-    return GetProperty("damage");
+    return GetProperty(DAMAGE_KEY);
 }
 
 void Action::SetDamage(int value) {
-    SetProperty("damage", value);
-}
-
-void Action::CreateEffectsFromProperties() {
-    // Clear existing effects
-    effects.clear();
-    
-    // Based on the action type and properties, create appropriate effects
-    switch (type) {
-        case ActionType::ATTACK: {
-            int damage = GetProperty("damage");
-            bool isPhysical = GetProperty("is_physical") > 0;
-            if (damage > 0) {
-                effects.push_back(std::make_unique<DamageEffect>(damage, isPhysical));
-            }
-            break;
-        }
-        
-        case ActionType::HEAL: {
-            int healAmount = GetProperty("damage"); // Reuse damage field for heal amount
-            if (healAmount > 0) {
-                effects.push_back(std::make_unique<HealingEffect>(healAmount));
-            }
-            break;
-        }
-        
-        case ActionType::MOVEMENT: {
-            int positionChange = GetProperty("position_change");
-            if (positionChange != 0) {
-                effects.push_back(std::make_unique<MovementEffect>(positionChange));
-            }
-            break;
-        }
-        
-        case ActionType::BUFF:
-        case ActionType::DEBUFF: {
-            // Check for stat modifiers (format: "mod_STATNAME")
-            for (const auto& [key, value] : properties) {
-                if (key.substr(0, 4) == "mod_") {
-                    std::string statName = key.substr(4);
-                    
-                    // Convert string to StatType
-                    StatType statType;
-                    if (statName == "STRENGTH") statType = StatType::STRENGTH;
-                    else if (statName == "INTELLECT") statType = StatType::INTELLECT;
-                    else if (statName == "SPEED") statType = StatType::SPEED;
-                    else if (statName == "DEXTERITY") statType = StatType::DEXTERITY;
-                    else if (statName == "CONSTITUTION") statType = StatType::CONSTITUTION;
-                    else if (statName == "DEFENSE") statType = StatType::DEFENSE;
-                    else if (statName == "LUCK") statType = StatType::LUCK;
-                    else continue; // Not a valid stat
-                    
-                    // Duration for effect
-                    int duration = GetProperty("duration");
-                    if (duration <= 0) duration = 3; // Default 3 turns
-                    
-                    effects.push_back(std::make_unique<StatModifierEffect>(statType, value, duration));
-                }
-            }
-            break;
-        }
-        
-        case ActionType::COMPOUND: {
-            // For compound actions, check for all possible effect types
-            
-            // Check for damage
-            int damage = GetProperty("damage");
-            bool isPhysical = GetProperty("is_physical") > 0;
-            if (damage > 0) {
-                effects.push_back(std::make_unique<DamageEffect>(damage, isPhysical));
-            }
-            
-            // Check for healing
-            int healAmount = GetProperty("heal_amount");
-            if (healAmount > 0) {
-                // For life drain, we want to heal the user, not the target
-                class SelfHealingEffect : public HealingEffect {
-                public:
-                    explicit SelfHealingEffect(int amount) : HealingEffect(amount) {}
-                    
-                    bool Execute(Entity* user, Entity* target, Battlefield* battlefield) override {
-                        // Override to heal the user instead of the target
-                        return HealingEffect::Execute(user, user, battlefield);
-                    }
-                    
-                    bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const override {
-                        // Check if user has health to heal
-                        if (!user || !user->HasComponent<StatsComponent>()) {
-                            return false;
-                        }
-                        
-                        auto& stats = const_cast<Entity*>(user)->GetComponent<StatsComponent>();
-                        if (stats.GetCurrentHealth() >= stats.GetMaxHealth()) {
-                            std::cout << user->GetName() << " is already at full health." << std::endl;
-                            return false;
-                        }
-                        
-                        return true;
-                    }
-                };
-                
-                effects.push_back(std::make_unique<SelfHealingEffect>(healAmount));
-            }
-            
-            // Check for self movement (like in Charge)
-            int positionChange = GetProperty("position_change");
-            if (positionChange != 0) {
-                // For charge, we want to move the user, not the target
-                class SelfMovementEffect : public MovementEffect {
-                public:
-                    explicit SelfMovementEffect(int change) : MovementEffect(change) {}
-                    
-                    bool Execute(Entity* user, Entity* target, Battlefield* battlefield) override {
-                        // Override to move the user instead of the target
-                        return MovementEffect::Execute(user, user, battlefield);
-                    }
-                    
-                    bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const override {
-                        // Check if user can move
-                        return MovementEffect::CanApply(user, user, battlefield);
-                    }
-                };
-                
-                effects.push_back(std::make_unique<SelfMovementEffect>(positionChange));
-            }
-            
-            // Check for stat modifiers
-            for (const auto& [key, value] : properties) {
-                if (key.substr(0, 4) == "mod_") {
-                    std::string statName = key.substr(4);
-                    
-                    // Convert string to StatType
-                    StatType statType;
-                    if (statName == "STRENGTH") statType = StatType::STRENGTH;
-                    else if (statName == "INTELLECT") statType = StatType::INTELLECT;
-                    else if (statName == "SPEED") statType = StatType::SPEED;
-                    else if (statName == "DEXTERITY") statType = StatType::DEXTERITY;
-                    else if (statName == "CONSTITUTION") statType = StatType::CONSTITUTION;
-                    else if (statName == "DEFENSE") statType = StatType::DEFENSE;
-                    else if (statName == "LUCK") statType = StatType::LUCK;
-                    else continue; // Not a valid stat
-                    
-                    // Duration for effect
-                    int duration = GetProperty("duration");
-                    if (duration <= 0) duration = 3; // Default 3 turns
-                    
-                    // For power_strike, we want to buff ourselves and attack the enemy
-                    if (value > 0) {  // Buff effect (usually for self)
-                        class SelfStatModifierEffect : public StatModifierEffect {
-                        public:
-                            SelfStatModifierEffect(StatType type, int val, int dur) 
-                                : StatModifierEffect(type, val, dur) {}
-                            
-                            bool Execute(Entity* user, Entity* target, Battlefield* battlefield) override {
-                                // Override to buff the user instead of the target
-                                return StatModifierEffect::Execute(user, user, battlefield);
-                            }
-                            
-                            bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const override {
-                                return user && user->HasComponent<StatsComponent>();
-                            }
-                        };
-                        
-                        effects.push_back(std::make_unique<SelfStatModifierEffect>(statType, value, duration));
-                    } else {  // Debuff effect (usually for enemy)
-                        effects.push_back(std::make_unique<StatModifierEffect>(statType, value, duration));
-                    }
-                }
-            }
-            break;
-        }
-        
-        case ActionType::SPECIAL:
-        default:
-            // For special actions, we rely on the effectCallback
-            break;
-    }
+    SetProperty(DAMAGE_KEY, value);
 }
 
 } // namespace Game 
\ No newline at end of file
@@ -1,16 +1,21 @@
 #pragma once
 
 #include <string>
-#include <functional>
+#include <string_view>
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 #include "../entities/Entity.h"
 #include "../entities/components/StatsComponent.h"
+#include "../../engine/core/StringInterner.h"
 
 namespace Game {
 
-// Forward declaration
+// Forward declarations
 class Battlefield;
+class ResolutionEngine;
+class ActionDataLoader;
 
 // Types of actions that can be performed
 enum class ActionType {
@@ -23,66 +28,54 @@ enum class ActionType {
     COMPOUND    // Multiple effects combined
 };
 
-// Effect interface - represents a single effect that an action can have
-class ActionEffect {
-public:
-    virtual ~ActionEffect() = default;
-    
-    // Execute the effect
-    virtual bool Execute(Entity* user, Entity* target, Battlefield* battlefield) = 0;
-    
-    // Check if the effect can be applied
-    virtual bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const = 0;
+// Operations understood by the effect interpreter
+enum class EffectOp : uint8_t {
+    DAMAGE,         // Deal damage scaled by STR (physical) or INT (magical)
+    HEAL,           // Restore health
+    MOVE,           // Shift position on the battlefield
+    MODIFY_STAT     // Add a temporary stat modifier
 };
 
-// Damage effect - deals damage to target
-class DamageEffect : public ActionEffect {
-public:
-    DamageEffect(int baseDamage, bool isPhysical = true);
-    bool Execute(Entity* user, Entity* target, Battlefield* battlefield) override;
-    bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const override;
-    
-private:
-    int damage;
-    bool isPhysical;
+// Which entity an effect instruction applies to
+enum class EffectTarget : uint8_t {
+    TARGET,         // The entity the action was used on
+    USER            // The entity using the action
 };
 
-// Healing effect - restores health to target
-class HealingEffect : public ActionEffect {
-public:
-    explicit HealingEffect(int healAmount);
-    bool Execute(Entity* user, Entity* target, Battlefield* battlefield) override;
-    bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const override;
-    
-private:
-    int amount;
+// Which combatants an action affects, relative to the chosen target
+enum class TargetShape : uint8_t {
+    SINGLE,         // Only the chosen target
+    TILE_RANGE,     // Every combatant within `area` tiles of the target, on its side
+    SIDE,           // Every combatant on the target's side
+    CHAIN           // The target, then up to `area` jumps to the nearest unhit combatant
 };
 
-// Movement effect - changes position on battlefield
-class MovementEffect : public ActionEffect {
-public:
-    explicit MovementEffect(int positionChange);
-    bool Execute(Entity* user, Entity* target, Battlefield* battlefield) override;
-    bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const override;
-    
-private:
-    int positionChange;
+// A combatant caught by an action and how strongly it is affected
+struct AffectedTarget {
+    Entity* entity;
+    int scalePercent;   // Damage/heal scaling relative to the chosen target (100 = full)
 };
 
-// Stat modifier effect - buffs or debuffs a stat
-class StatModifierEffect : public ActionEffect {
-public:
-    StatModifierEffect(StatType statType, int value, int duration);
-    bool Execute(Entity* user, Entity* target, Battlefield* battlefield) override;
-    bool CanApply(const Entity* user, const Entity* target, const Battlefield* battlefield) const override;
-    
-private:
-    StatType statType;
-    int value;
-    int duration;
+// A single compiled effect with all operands resolved at load time
+struct EffectInstruction {
+    EffectOp op;
+    EffectTarget target;
+    StatType stat;      // MODIFY_STAT only
+    bool isPhysical;    // DAMAGE only
+    int amount;         // Damage, heal amount, position change or modifier value
+    int duration;       // MODIFY_STAT only
 };
 
-// Class for combat actions (attacks, abilities, etc.)
+// Outcome of executing an action
+enum class ActionResult : uint8_t {
+    INVALID,        // The action could not be used (nothing happened)
+    MISSED,         // The action was used but missed (cooldown still applies)
+    EXECUTED        // At least one effect was applied
+};
+
+// Immutable combat action definition (attacks, abilities, etc.)
+// Definitions are shared between every entity that knows the action, so all
+// per-user state such as cooldowns lives in ActionSetComponent instead.
 class Action {
 public:
     // Constructor with basic properties
@@ -91,14 +84,16 @@ public:
     // Destructor
     virtual ~Action();
     
-    // Execute the action
-    virtual bool Execute(Entity* user, Entity* target, Battlefield* battlefield);
+    // Execute the action; every roll is drawn from the combat's resolution engine
+    virtual ActionResult Execute(Entity* user, Entity* target, Battlefield* battlefield,
+                                 ResolutionEngine& resolution) const;
     
-    // Check if the action can be used
+    // Check if the action can be used (cooldowns are checked by ActionSetComponent)
     virtual bool CanUse(const Entity* user, const Entity* target, const Battlefield* battlefield) const;
     
     // Get action details
     const std::string& GetID() const { return id; }
+    Engine::StringId GetKey() const { return key; }     // Interned ID
     const std::string& GetName() const { return name; }
     const std::string& GetDescription() const { return description; }
     ActionType GetType() const { return type; }
@@ -110,49 +105,65 @@ public:
     int GetAccuracy() const { return accuracy; }
     int GetRange() const { return range; }
     int GetCooldown() const { return cooldown; }
-    int GetCurrentCooldown() const { return currentCooldown; }
+    TargetShape GetTargetShape() const { return targetShape; }
+    int GetArea() const { return area; }
+    int GetSplashPercent() const { return splashPercent; }
+    bool IsMultiTarget() const { return targetShape != TargetShape::SINGLE; }
     
     // Set action properties
     void SetAccuracy(int value) { accuracy = value; }
     void SetRange(int value) { range = value; }
     void SetCooldown(int value) { cooldown = value; }
+    void SetTargetShape(TargetShape shape) { targetShape = shape; }
+    void SetArea(int value) { area = value; }
+    void SetSplashPercent(int value) { splashPercent = value; }
     
     // For backward compatibility
     int GetDamage() const; 
     void SetDamage(int value);
     
-    // Cooldown management
-    void StartCooldown() { currentCooldown = cooldown; }
-    void DecreaseCooldown() { if (currentCooldown > 0) currentCooldown--; }
-    bool IsOnCooldown() const { return currentCooldown > 0; }
-    
-    // Custom effect callback
-    void SetEffectCallback(std::function<void(Entity*, Entity*, Battlefield*)> callback) {
-        effectCallback = callback;
+    // Add or set an additional property (keys are interned)
+    void SetProperty(std::string_view key, int value) {
+        SetProperty(Engine::StringInterner::GetInstance().Intern(key), value);
     }
-    
-    // Add or set an additional property
-    void SetProperty(const std::string& key, int value) {
+    void SetProperty(Engine::StringId key, int value) {
         properties[key] = value;
+        compiled = false;
     }
     
     // Get an additional property (returns 0 if not found)
-    int GetProperty(const std::string& key) const {
+    int GetProperty(std::string_view key) const {
+        Engine::StringId keyId;
+        return Engine::StringInterner::GetInstance().Find(key, keyId) ? GetProperty(keyId) : 0;
+    }
+    int GetProperty(Engine::StringId key) const {
         auto it = properties.find(key);
         return (it != properties.end()) ? it->second : 0;
     }
     
-    // Add an effect to this action
-    void AddEffect(std::unique_ptr<ActionEffect> effect) {
-        effects.push_back(std::move(effect));
-    }
+    // Compile properties into the effect program (called once by the loader)
+    void Compile();
+    
+    // Check if the effect program is up to date with the properties
+    bool IsCompiled() const { return compiled; }
+    
+    // Get the compiled effect program
+    const std::vector<EffectInstruction>& GetProgram() const { return program; }
     
-    // Create standard effects based on properties
-    void CreateEffectsFromProperties();
+    // Targeting flags resolved at compile time
+    bool IsSelfOnly() const { return selfOnly; }
+    bool CanTargetSelf() const { return canTargetSelf; }
+    int GetPositionChange() const { return positionChange; }
+    
+    // Gather every combatant affected when this action is used on the target.
+    // The chosen target is always first; the rest follow the target shape.
+    void CollectTargets(Entity* target, const Battlefield* battlefield,
+                        std::vector<AffectedTarget>& targets) const;
     
 private:
     // Basic identification
     std::string id;              // Unique identifier
+    Engine::StringId key;        // Interned id
     std::string name;            // Display name
     std::string description;     // Action description
     ActionType type;             // Type of action
@@ -160,17 +171,53 @@ private:
     // Core properties
     int accuracy = 100;          // Hit chance percentage (0-100)
     int range = 1;               // Required distance to use (tiles)
-    int cooldown = 0;            // Turns before reuse
-    int currentCooldown = 0;     // Current cooldown countdown
+    int cooldown = 0;            // Rounds before reuse
     
-    // Custom effect callback
-    std::function<void(Entity*, Entity*, Battlefield*)> effectCallback = nullptr;
+    // Area of effect
+    TargetShape targetShape = TargetShape::SINGLE;
+    int area = 0;                // Tile radius (TILE_RANGE) or extra jumps (CHAIN)
+    int splashPercent = 100;     // Strength on secondary targets (compounds per CHAIN jump)
     
     // Additional properties (knockback, healing amount, etc.)
-    std::unordered_map<std::string, int> properties;
+    std::unordered_map<Engine::StringId, int> properties;
+    
+    // Compiled effect program and the flags resolved alongside it
+    std::vector<EffectInstruction> program;
+    bool compiled = false;
+    bool selfOnly = false;
+    bool canTargetSelf = false;
+    int positionChange = 0;
+    
+    // Interpreter for a single instruction
+    bool CanApply(const EffectInstruction& instruction, const Entity* user, 
+                  const Entity* target, const Battlefield* battlefield) const;
+    bool Apply(const EffectInstruction& instruction, Entity* user, 
+               Entity* target, Battlefield* battlefield, ResolutionEngine& resolution) const;
+    
+    // Run a TARGET instruction over every affected combatant
+    bool ApplyToTargets(const EffectInstruction& instruction, Entity* user,
+                        const std::vector<AffectedTarget>& targets, Battlefield* battlefield,
+                        ResolutionEngine& resolution) const;
+    
+    // Resolve damage, crits and blocks for all affected combatants in one pass
+    bool ApplyDamage(const EffectInstruction& instruction, Entity* user,
+                     const std::vector<AffectedTarget>& targets, ResolutionEngine& resolution) const;
+};
+
+// The current definition of one action ID. The action loader keeps one per
+// ID and everything that learns the action holds it, so a reload can swap in
+// a freshly built definition for every holder without modifying the old one.
+class ActionRef {
+public:
+    explicit ActionRef(std::shared_ptr<const Action> definition) : definition(std::move(definition)) {}
+    
+    // The definition to use right now
+    const std::shared_ptr<const Action>& Get() const { return definition; }
+    
+private:
+    friend class ActionDataLoader;
     
-    // Collection of effects this action will apply
-    std::vector<std::unique_ptr<ActionEffect>> effects;
+    std::shared_ptr<const Action> definition;
 };
 
 } // namespace Game 
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Battlefield.h"
+#include "CombatLog.h"
 #include <algorithm>
 #include <iostream>
 
@@ -14,19 +15,19 @@ Battlefield::Battlefield() {
 bool Battlefield::PlaceEntity(std::shared_ptr<Entity> entity, int position) {
     // Check if the position is valid
     if (!IsValidPosition(position)) {
-        std::cout << "Invalid position: " << position << std::endl;
+        CombatLog::Out() << "Invalid position: " << position << std::endl;
         return false;
     }
     
     // Check if the position is already occupied
     if (IsPositionOccupied(position)) {
-        std::cout << "Position " << position << " is already occupied" << std::endl;
+        CombatLog::Out() << "Position " << position << " is already occupied" << std::endl;
         return false;
     }
     
     // Make sure the entity has a position component
     if (!entity->HasComponent<PositionComponent>()) {
-        std::cout << "Entity does not have a PositionComponent, adding one" << std::endl;
+        CombatLog::Out() << "Entity does not have a PositionComponent, adding one" << std::endl;
         // Create a position component first, then add it
         PositionComponent posComp;
         posComp.SetPosition(position);
@@ -46,25 +47,25 @@ bool Battlefield::MoveEntity(Entity* entity, int newPosition) {
     // Check if the entity exists on the battlefield
     int entityIndex = GetEntityIndex(entity);
     if (entityIndex == -1) {
-        std::cout << "Entity not found on battlefield" << std::endl;
+        CombatLog::Out() << "Entity not found on battlefield" << std::endl;
         return false;
     }
     
     // Check if the new position is valid
     if (!IsValidPosition(newPosition)) {
-        std::cout << "Invalid new position: " << newPosition << std::endl;
+        CombatLog::Out() << "Invalid new position: " << newPosition << std::endl;
         return false;
     }
     
     // Check if the new position is already occupied
     if (IsPositionOccupied(newPosition)) {
-        std::cout << "New position " << newPosition << " is already occupied" << std::endl;
+        CombatLog::Out() << "New position " << newPosition << " is already occupied" << std::endl;
         return false;
     }
     
     // Get the entity's position component
     if (!entity->HasComponent<PositionComponent>()) {
-        std::cout << "Entity does not have a PositionComponent" << std::endl;
+        CombatLog::Out() << "Entity does not have a PositionComponent" << std::endl;
         return false;
     }
     
@@ -0,0 +1,31 @@
+#include "CombatLog.h"
+#include <iostream>
+
+namespace Game {
+
+namespace {
+
+thread_local std::ostream* currentStream = nullptr;
+
+} // namespace
+
+std::ostream& CombatLog::Out() {
+    return currentStream ? *currentStream : std::cout;
+}
+
+std::ostream& CombatLog::Silent() {
+    // No buffer, so the stream is permanently bad and every write is a no-op
+    thread_local std::ostream silent(nullptr);
+    return silent;
+}
+
+CombatLog::Scope::Scope(std::ostream& stream)
+    : previous(currentStream) {
+    currentStream = &stream;
+}
+
+CombatLog::Scope::~Scope() {
+    currentStream = previous;
+}
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <ostream>
+
+namespace Game {
+
+// Where combat narration goes. Combat code writes every roll and turn to
+// CombatLog::Out() instead of std::cout. The stream is chosen per thread,
+// so a headless fight (auto-resolve, simulations) can silence or capture
+// its own narration without touching the process-wide std::cout.
+class CombatLog {
+public:
+    // This thread's narration stream (std::cout unless a Scope is active)
+    static std::ostream& Out();
+
+    // A stream that rejects every write before doing any formatting
+    static std::ostream& Silent();
+
+    // Sends this thread's narration to another stream for its lifetime
+    class Scope {
+    public:
+        explicit Scope(std::ostream& stream);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::ostream* previous;
+    };
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -1,19 +1,25 @@
 #include "CombatSystem.h"
+#include "ResolutionEngine.h"
 #include "../../engine/core/EventSystem.h"
 #include "../entities/components/StatsComponent.h"
 #include "../entities/components/PositionComponent.h"
+#include "../entities/components/ActionSetComponent.h"
+#include "CombatLog.h"
 #include <iostream>
 #include <algorithm>
-#include <cstdlib>
-#include <ctime>
 
 namespace Game {
 
 CombatSystem::CombatSystem()
     : eventSystem(nullptr),
-      state(CombatState::NOT_STARTED) {
-    // Seed random number generator for escape chances and other random elements
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+      state(CombatState::NOT_STARTED),
+      cooldownRound(0) {
+    // Escape chances and hit rolls come from this combat's own ResolutionEngine
+}
+
+CombatSystem::~CombatSystem() {
+    // Entities may outlive the combat system, so give their cooldowns back
+    UnbindCooldowns();
 }
 
 void CombatSystem::SetEventSystem(Engine::EventSystem* eventSystem) {
@@ -50,65 +56,73 @@ void CombatSystem::StartCombat(const std::vector<std::shared_ptr<Entity>>& playe
     allEntities.insert(allEntities.end(), enemyTeam.begin(), enemyTeam.end());
     turnManager.Initialize(allEntities);
     
+    // Pool everyone's cooldowns so a round tick is a single pass
+    for (const auto& entity : allEntities) {
+        if (entity && entity->HasComponent<ActionSetComponent>()) {
+            entity->GetComponent<ActionSetComponent>().BindCooldowns(cooldowns);
+        }
+    }
+    cooldownRound = turnManager.GetCurrentRound();
+    
     // Set combat state to started
     state = CombatState::SELECTING_ACTION;
     
     // Publish combat start event if event system is available
     if (eventSystem) {
-        Engine::Event event(Engine::EventType::COMBAT_START);
+        Engine::Event event(Engine::EventType::COMBAT_START, Engine::CombatStartEvent{});
         eventSystem->Publish(event);
     }
     
-    std::cout << "Combat started with " << playerTeam.size() << " player entities and "
-              << enemyTeam.size() << " enemy entities." << std::endl;
+    CombatLog::Out() << "Combat started with " << playerTeam.size() << " player entities and "
+                     << enemyTeam.size() << " enemy entities." << std::endl;
 }
 
-bool CombatSystem::ProcessTurn(std::shared_ptr<Action> action, std::shared_ptr<Entity> target) {
+bool CombatSystem::ProcessTurn(std::shared_ptr<const Action> action, std::shared_ptr<Entity> target) {
     auto currentEntity = turnManager.GetCurrentEntity();
     
     // Validate that an entity is active and has an action
     if (!currentEntity || !action) {
-        std::cout << "No active entity or action to process" << std::endl;
+        CombatLog::Out() << "No active entity or action to process" << std::endl;
         return false;
     }
     
     // Check if it's actually this entity's turn
     if (GetCurrentEntity() != currentEntity) {
-        std::cout << "Not " << currentEntity->GetName() << "'s turn yet" << std::endl;
+        CombatLog::Out() << "Not " << currentEntity->GetName() << "'s turn yet" << std::endl;
         return false;
     }
     
-    // Execute the action
+    // Only actions from the entity's own action set can be used, so cooldowns are always tracked
+    int slot = -1;
+    if (currentEntity->HasComponent<ActionSetComponent>()) {
+        slot = currentEntity->GetComponent<ActionSetComponent>().FindSlot(action.get());
+    }
+    if (slot < 0) {
+        CombatLog::Out() << currentEntity->GetName() << " does not know " << action->GetName() << std::endl;
+        return false;
+    }
+
     state = CombatState::EXECUTING_ACTION;
-    bool success = action->Execute(currentEntity.get(), target.get(), &battlefield);
-    
+    ActionResult result = currentEntity->GetComponent<ActionSetComponent>().Use(slot, target.get(), &battlefield, resolution);
+
+    bool success = (result == ActionResult::EXECUTED);
     if (success) {
         // Publish action event if event system is available
         if (eventSystem) {
             // Note: In a full implementation, you'd add ACTION_EXECUTED to the Engine::EventType enum
             // For now, use an existing event type as a workaround
-            Engine::Event event(Engine::EventType::PLAYER_MOVE);
-            event.SetData("action_name", action->GetName());
-            event.SetData("user_name", currentEntity->GetName());
-            event.SetData("target_name", target->GetName());
-            eventSystem->Publish(event);
+            Engine::PlayerMoveEvent move;
+            move.actionName = action->GetName();
+            move.userName = currentEntity->GetName();
+            move.targetName = target ? std::string_view(target->GetName()) : std::string_view();
+            eventSystem->Publish(Engine::Event(Engine::EventType::PLAYER_MOVE, move));
         }
         
         // End the turn
-        turnManager.EndTurn();
+        EndTurn();
         
-        // Check if combat is over
-        if (CheckCombatResult() != CombatResult::NONE) {
-            state = CombatState::ENDED;
-        } else {
-            // Determine next state based on whose turn it is
-            auto nextEntity = turnManager.GetCurrentEntity();
-            if (nextEntity && IsPlayerEntity(nextEntity)) {
-                state = CombatState::SELECTING_ACTION;
-            } else {
-                state = CombatState::ENEMY_TURN;
-            }
-        }
+        // Check if combat is over, otherwise hand over to the next entity
+        UpdateStateForCurrentEntity();
     } else {
         // Action failed, but turn continues (player can try another action)
         state = CombatState::SELECTING_ACTION;
@@ -149,6 +163,14 @@ CombatResult CombatSystem::CheckCombatResult() const {
 }
 
 void CombatSystem::Reset() {
+    // Return cooldowns to the combatants and release the shared table
+    UnbindCooldowns();
+    cooldowns.Clear();
+    cooldownRound = 0;
+    
+    // Outcome tables are per combatant pair, so they don't outlive the fight
+    resolution.ClearCache();
+    
     // Clear the battlefield
     battlefield.Clear();
     
@@ -175,27 +197,36 @@ TurnManager& CombatSystem::GetTurnManager() {
     return turnManager;
 }
 
-std::vector<std::shared_ptr<Action>> CombatSystem::GetAvailableActions() const {
-    std::vector<std::shared_ptr<Action>> availableActions;
+ResolutionEngine& CombatSystem::GetResolution() {
+    return resolution;
+}
+
+void CombatSystem::Seed(uint32_t seed) {
+    resolution.Seed(seed);
+}
+
+std::vector<std::shared_ptr<const Action>> CombatSystem::GetAvailableActions() const {
+    std::vector<std::shared_ptr<const Action>> availableActions;
     
     auto currentEntity = turnManager.GetCurrentEntity();
     if (!currentEntity) {
         return availableActions;
     }
     
-    // In a real implementation, this would retrieve actions from the entity's
-    // action list, equipment, or class definition. For now, return an empty list.
-    // This would be replaced with actual action retrieval logic.
-    
-    // Example placeholder code:
-    // if (currentEntity->HasComponent<ActionComponent>()) {
-    //    availableActions = currentEntity->GetComponent<ActionComponent>().GetActions();
-    // }
+    // Actions come from the entity's action set; skip any still on cooldown
+    if (currentEntity->HasComponent<ActionSetComponent>()) {
+        const auto& actionSet = currentEntity->GetComponent<ActionSetComponent>();
+        for (size_t slot = 0; slot < actionSet.GetActionCount(); ++slot) {
+            if (!actionSet.IsOnCooldown(slot)) {
+                availableActions.push_back(actionSet.GetAction(slot));
+            }
+        }
+    }
     
     return availableActions;
 }
 
-std::vector<std::shared_ptr<Entity>> CombatSystem::GetValidTargets(std::shared_ptr<Action> action) const {
+std::vector<std::shared_ptr<Entity>> CombatSystem::GetValidTargets(std::shared_ptr<const Action> action) const {
     std::vector<std::shared_ptr<Entity>> validTargets;
     
     if (!action) {
@@ -276,11 +307,11 @@ bool CombatSystem::TryEscape() {
     escapeChance = std::max(10, std::min(90, escapeChance));
     
     // Roll for escape
-    int roll = std::rand() % 100 + 1; // 1-100
+    int roll = resolution.RollPercent(); // 1-100
     bool escaped = roll <= escapeChance;
     
-    std::cout << "Escape attempt! Chance: " << escapeChance << "%, Roll: " << roll 
-              << ", " << (escaped ? "Success!" : "Failed!") << std::endl;
+    CombatLog::Out() << "Escape attempt! Chance: " << escapeChance << "%, Roll: " << roll 
+                     << ", " << (escaped ? "Success!" : "Failed!") << std::endl;
     
     if (escaped) {
         state = CombatState::ENDED;
@@ -289,21 +320,16 @@ bool CombatSystem::TryEscape() {
         if (eventSystem) {
             // Note: In a full implementation, you'd add COMBAT_ESCAPE to the Engine::EventType enum
             // For now, use an existing event type as a workaround
-            Engine::Event event(Engine::EventType::PLAYER_MOVE);
-            event.SetData("action", "escape");
-            eventSystem->Publish(event);
+            Engine::PlayerMoveEvent move;
+            move.escaped = true;
+            eventSystem->Publish(Engine::Event(Engine::EventType::PLAYER_MOVE, move));
         }
     } else {
         // Failed escape costs a turn
-        turnManager.EndTurn();
+        EndTurn();
         
         // Check whose turn is next
-        auto nextEntity = turnManager.GetCurrentEntity();
-        if (nextEntity && IsPlayerEntity(nextEntity)) {
-            state = CombatState::SELECTING_ACTION;
-        } else {
-            state = CombatState::ENEMY_TURN;
-        }
+        UpdateStateForCurrentEntity();
     }
     
     return escaped;
@@ -321,94 +347,154 @@ bool CombatSystem::ProcessEnemyTurn() {
         return false;
     }
     
-    // Select an action and target for the enemy
-    auto [action, target] = SelectEnemyAction(enemy);
+    return ProcessAutoTurn();
+}
+
+bool CombatSystem::ProcessAutoTurn() {
+    auto entity = turnManager.GetCurrentEntity();
+    if (!entity || state == CombatState::ENDED) {
+        return false;
+    }
+    
+    // Select an action and target for the entity
+    auto [action, target] = SelectAutoAction(entity);
     
     // Process the turn with the selected action
     if (action && target) {
-        std::cout << enemy->GetName() << " uses " << action->GetName() << " on " 
-                  << target->GetName() << std::endl;
-                  
-        return ProcessTurn(action, target);
+        CombatLog::Out() << entity->GetName() << " uses " << action->GetName() << " on " 
+                         << target->GetName() << std::endl;
+        
+        if (ProcessTurn(action, target)) {
+            return true;
+        }
+        
+        // A miss or failed action still costs the AI its turn
+        CombatLog::Out() << entity->GetName() << " wasted the turn." << std::endl;
+    } else {
+        CombatLog::Out() << entity->GetName() << " has no valid actions." << std::endl;
     }
     
     // If no valid action was found, just end the turn
-    std::cout << enemy->GetName() << " has no valid actions." << std::endl;
-    turnManager.EndTurn();
-    
-    // Set next state
-    auto nextEntity = turnManager.GetCurrentEntity();
-    if (nextEntity && IsPlayerEntity(nextEntity)) {
-        state = CombatState::SELECTING_ACTION;
-    } else {
-        state = CombatState::ENEMY_TURN;
-    }
+    EndTurn();
+    UpdateStateForCurrentEntity();
     
     return true;
 }
 
-std::pair<std::shared_ptr<Action>, std::shared_ptr<Entity>> CombatSystem::SelectEnemyAction(
-    std::shared_ptr<Entity> enemy) {
-    // This is a placeholder for enemy AI decision-making
-    // In a full implementation, this would consider various factors:
-    // - Enemy type and predefined behavior patterns
-    // - Available actions and their effectiveness
-    // - Current health and status effects
-    // - Positioning on the battlefield
-    
-    // For now, return a simple null action (enemy will just skip turn)
-    return {nullptr, nullptr};
+std::pair<std::shared_ptr<const Action>, std::shared_ptr<Entity>> CombatSystem::SelectAutoAction(
+    std::shared_ptr<Entity> entity) {
+    // Only actions off cooldown are considered
+    std::vector<std::shared_ptr<const Action>> actions = GetAvailableActions();
+    if (actions.empty() || !entity->HasComponent<StatsComponent>()) {
+        return {nullptr, nullptr};
+    }
     
-    // Example of a more sophisticated implementation (commented out):
-    /*
-    std::vector<std::shared_ptr<Action>> actions = GetAvailableActions();
+    auto& stats = entity->GetComponent<StatsComponent>();
+    const auto& opponents = IsPlayerEntity(entity) ? enemyTeam : playerTeam;
     
     // First priority: healing if low health
-    if (enemy->GetComponent<StatsComponent>().GetHealthPercentage() < 0.3) {
-        // Look for healing actions
+    if (stats.GetCurrentHealth() * 10 < stats.GetMaxHealth() * 3) {
         for (auto& action : actions) {
-            if (action->GetType() == ActionType::HEAL) {
-                return {action, enemy}; // Self-heal
+            if (action->GetType() == ActionType::HEAL && 
+                action->CanUse(entity.get(), entity.get(), &battlefield)) {
+                return {action, entity}; // Self-heal
             }
         }
     }
     
-    // Second priority: attack player with highest damage action
-    std::shared_ptr<Action> bestAttack = nullptr;
-    int highestDamage = 0;
+    // Second priority: the attack with the highest exact expected damage
+    std::shared_ptr<const Action> bestAction = nullptr;
+    std::shared_ptr<Entity> bestTarget = nullptr;
+    float bestDamage = 0.0f;
+    int bestTargetHealth = 0;
+    std::vector<AffectedTarget> affected;
     
     for (auto& action : actions) {
-        if (action->GetType() == ActionType::ATTACK) {
-            int damage = action->GetDamage();
-            if (damage > highestDamage) {
-                highestDamage = damage;
-                bestAttack = action;
+        if (action->GetType() != ActionType::ATTACK && action->GetType() != ActionType::COMPOUND) {
+            continue;
+        }
+        
+        for (auto& target : opponents) {
+            if (!target || !target->HasComponent<StatsComponent>() || 
+                target->GetComponent<StatsComponent>().IsDead() ||
+                !action->CanUse(entity.get(), target.get(), &battlefield)) {
+                continue;
+            }
+            
+            // Area actions count the damage on everyone they catch
+            float damage = 0.0f;
+            action->CollectTargets(target.get(), &battlefield, affected);
+            for (const auto& hit : affected) {
+                damage += resolution.ExpectedDamage(*action, entity.get(), hit.entity) * hit.scalePercent / 100.0f;
+            }
+            
+            // Prefer finishing off the most wounded target on ties
+            int targetHealth = target->GetComponent<StatsComponent>().GetCurrentHealth();
+            if (damage > bestDamage || (damage == bestDamage && bestTarget && targetHealth < bestTargetHealth)) {
+                bestDamage = damage;
+                bestAction = action;
+                bestTarget = target;
+                bestTargetHealth = targetHealth;
             }
         }
     }
     
-    if (bestAttack) {
-        // Find most vulnerable player (lowest health percentage)
-        std::shared_ptr<Entity> bestTarget = nullptr;
-        float lowestHealth = 1.0f;
-        
-        for (auto& target : playerTeam) {
-            if (!target->GetComponent<StatsComponent>().IsDead()) {
-                float healthPct = target->GetComponent<StatsComponent>().GetHealthPercentage();
-                if (healthPct < lowestHealth) {
-                    lowestHealth = healthPct;
-                    bestTarget = target;
-                }
+    if (bestAction) {
+        return {bestAction, bestTarget};
+    }
+    
+    // Third priority: close the distance to the opponents
+    if (entity->HasComponent<PositionComponent>()) {
+        int forward = IsPlayerEntity(entity) ? 1 : -1;
+        for (auto& action : actions) {
+            if (action->GetType() == ActionType::MOVEMENT && 
+                action->GetPositionChange() * forward > 0 &&
+                action->CanUse(entity.get(), entity.get(), &battlefield)) {
+                return {action, entity};
             }
         }
-        
-        if (bestTarget) {
-            return {bestAttack, bestTarget};
-        }
     }
     
     return {nullptr, nullptr};
-    */
+}
+
+void CombatSystem::UpdateStateForCurrentEntity() {
+    if (CheckCombatResult() != CombatResult::NONE) {
+        state = CombatState::ENDED;
+        return;
+    }
+    
+    // Determine next state based on whose turn it is
+    auto nextEntity = turnManager.GetCurrentEntity();
+    if (nextEntity && IsPlayerEntity(nextEntity)) {
+        state = CombatState::SELECTING_ACTION;
+    } else {
+        state = CombatState::ENEMY_TURN;
+    }
+}
+
+void CombatSystem::EndTurn() {
+    turnManager.EndTurn();
+    
+    // Advance every combatant's cooldowns together once per round
+    int round = turnManager.GetCurrentRound();
+    if (round != cooldownRound) {
+        cooldownRound = round;
+        cooldowns.Tick();
+    }
+}
+
+void CombatSystem::UnbindCooldowns() {
+    for (const auto* team : {&playerTeam, &enemyTeam}) {
+        for (const auto& entity : *team) {
+            if (entity && entity->HasComponent<ActionSetComponent>()) {
+                auto& actionSet = entity->GetComponent<ActionSetComponent>();
+                if (actionSet.IsBoundTo(cooldowns)) {
+                    actionSet.UnbindCooldowns();
+                }
+            }
+        }
+    }
 }
 
 bool CombatSystem::IsPlayerEntity(const std::shared_ptr<Entity>& entity) const {
@@ -434,8 +520,8 @@ bool CombatSystem::IsSelfTargetedAction(const Action* action) const {
         return true;
     }
     
-    // Check for specific self_only property
-    if (action->GetProperty("self_only") > 0) {
+    // Check for the self_only flag resolved at load time
+    if (action->IsSelfOnly()) {
         return true;
     }
     
@@ -6,6 +6,8 @@
 #include "Battlefield.h"
 #include "TurnManager.h"
 #include "Action.h"
+#include "CooldownTable.h"
+#include "ResolutionEngine.h"
 #include "../entities/Entity.h"
 
 // Forward declarations for Engine namespace
@@ -38,6 +40,9 @@ public:
     // Constructor
     CombatSystem();
     
+    // Destructor (hands cooldowns back to the combatants)
+    ~CombatSystem();
+    
     // Set event system for publishing combat events
     void SetEventSystem(Engine::EventSystem* eventSystem);
     
@@ -46,7 +51,7 @@ public:
                      const std::vector<std::shared_ptr<Entity>>& enemyTeam);
     
     // Process a turn with the given action
-    bool ProcessTurn(std::shared_ptr<Action> action, std::shared_ptr<Entity> target);
+    bool ProcessTurn(std::shared_ptr<const Action> action, std::shared_ptr<Entity> target);
     
     // Check if combat is over and determine the result
     CombatResult CheckCombatResult() const;
@@ -63,11 +68,17 @@ public:
     // Get turn manager reference
     TurnManager& GetTurnManager();
     
+    // Get this combat's resolution engine (outcome tables and dice)
+    ResolutionEngine& GetResolution();
+    
+    // Seed this combat's rolls so the same fight plays out the same way
+    void Seed(uint32_t seed);
+    
     // Get all available actions for the current entity
-    std::vector<std::shared_ptr<Action>> GetAvailableActions() const;
+    std::vector<std::shared_ptr<const Action>> GetAvailableActions() const;
     
     // Get valid targets for the given action
-    std::vector<std::shared_ptr<Entity>> GetValidTargets(std::shared_ptr<Action> action) const;
+    std::vector<std::shared_ptr<Entity>> GetValidTargets(std::shared_ptr<const Action> action) const;
     
     // Try to escape from combat
     bool TryEscape();
@@ -77,11 +88,16 @@ public:
     
     // Process enemy AI turn (for automated enemy decisions)
     bool ProcessEnemyTurn();
+    
+    // Let the AI play the current entity's turn, whichever side it is on.
+    // The turn always ends, even if the chosen action fails or misses.
+    bool ProcessAutoTurn();
 
 private:
     // Core components
     Battlefield battlefield;
     TurnManager turnManager;
+    ResolutionEngine resolution;
     
     // Reference to event system for publishing events
     Engine::EventSystem* eventSystem;
@@ -93,9 +109,22 @@ private:
     // Combat state
     CombatState state;
     
-    // Select an action for an enemy (AI)
-    std::pair<std::shared_ptr<Action>, std::shared_ptr<Entity>> SelectEnemyAction(
-        std::shared_ptr<Entity> enemy);
+    // Cooldowns of every combatant, ticked together once per round
+    CooldownTable cooldowns;
+    int cooldownRound;
+    
+    // End the current turn and advance cooldowns if a new round began
+    void EndTurn();
+    
+    // Return every combatant's cooldowns to its ActionSetComponent
+    void UnbindCooldowns();
+    
+    // Select an action and target for an entity (AI)
+    std::pair<std::shared_ptr<const Action>, std::shared_ptr<Entity>> SelectAutoAction(
+        std::shared_ptr<Entity> entity);
+    
+    // Set the state from whoever's turn it is now
+    void UpdateStateForCurrentEntity();
     
     // Helper method to determine if an entity is on player team
     bool IsPlayerEntity(const std::shared_ptr<Entity>& entity) const;
@@ -0,0 +1,20 @@
+#include "CooldownTable.h"
+
+namespace Game {
+
+size_t CooldownTable::Allocate(size_t count) {
+    size_t base = cooldowns.size();
+    cooldowns.resize(base + count, 0);
+    return base;
+}
+
+void CooldownTable::Tick() {
+    // Branchless so the compiler can vectorize the whole table
+    int* data = cooldowns.data();
+    const size_t count = cooldowns.size();
+    for (size_t i = 0; i < count; ++i) {
+        data[i] -= (data[i] > 0);
+    }
+}
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Game {
+
+// Flat cooldown storage shared by every combatant in an encounter.
+// Each bound ActionSetComponent owns a contiguous block of slots, so
+// advancing all cooldowns by a round is a single pass over one array.
+class CooldownTable {
+public:
+    CooldownTable() = default;
+    
+    // Reserve a zeroed block of slots and return its first index
+    size_t Allocate(size_t count);
+    
+    // Access a single slot
+    int Get(size_t index) const { return cooldowns[index]; }
+    void Set(size_t index, int value) { cooldowns[index] = value; }
+    
+    // Decrement every active cooldown by one round
+    void Tick();
+    
+    // Release all slots
+    void Clear() { cooldowns.clear(); }
+    
+    // Number of allocated slots
+    size_t GetSize() const { return cooldowns.size(); }
+    
+private:
+    std::vector<int> cooldowns;
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include "ResolutionEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace Game {
+
+ResolutionEngine::ResolutionEngine() {
+    // Seed random generator with current time
+    rng.seed(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count()));
+}
+
+OutcomeTable ResolutionEngine::BuildTable(const StatsComponent& attacker, const StatsComponent& defender) {
+    // Same rules as the per-roll checks: crit if 1-100 roll <= crit chance,
+    // then block if 0-99 roll < block chance; a blocked crit does nothing
+    int critChance = std::max(0, std::min(100, attacker.CalculateCriticalChance()));
+    int blockChance = std::max(0, std::min(100, defender.CalculateBlockChance()));
+    
+    // Percent * percent fits SCALE exactly, so the table is lossless
+    OutcomeTable table;
+    table.blockBelow = static_cast<uint32_t>(blockChance * 100);
+    table.critBelow = table.blockBelow + static_cast<uint32_t>((100 - blockChance) * critChance);
+    return table;
+}
+
+const OutcomeTable& ResolutionEngine::GetTable(const StatsComponent& attacker, const StatsComponent& defender) {
+    CacheEntry& entry = cache[{&attacker, &defender}];
+    
+    // Rebuild only when either side's stats have changed
+    if (entry.attackerVersion != attacker.GetVersion() || 
+        entry.defenderVersion != defender.GetVersion()) {
+        entry.table = BuildTable(attacker, defender);
+        entry.attackerVersion = attacker.GetVersion();
+        entry.defenderVersion = defender.GetVersion();
+    }
+    
+    return entry.table;
+}
+
+bool ResolutionEngine::RollAccuracy(int accuracy) {
+    if (accuracy >= 100) {
+        return true;
+    }
+    
+    return RollPercent() <= accuracy;
+}
+
+int ResolutionEngine::RollPercent() {
+    std::uniform_int_distribution<int> roll(1, 100);
+    return roll(rng);
+}
+
+HitOutcome ResolutionEngine::Resolve(const StatsComponent& attacker, const StatsComponent& defender) {
+    std::uniform_int_distribution<uint32_t> draw(0, OutcomeTable::SCALE - 1);
+    return GetTable(attacker, defender).Sample(draw(rng));
+}
+
+float ResolutionEngine::ExpectedDamage(const Action& action, const Entity* user, const Entity* target) {
+    if (!user || !target || user == target ||
+        !user->HasComponent<StatsComponent>() || !target->HasComponent<StatsComponent>()) {
+        return 0.0f;
+    }
+    
+    const auto& userStats = const_cast<Entity*>(user)->GetComponent<StatsComponent>();
+    const auto& targetStats = const_cast<Entity*>(target)->GetComponent<StatsComponent>();
+    
+    // Sum the damage instructions exactly as the interpreter computes them
+    int landedDamage = 0;
+    for (const auto& instruction : action.GetProgram()) {
+        if (instruction.op != EffectOp::DAMAGE || instruction.target != EffectTarget::TARGET) {
+            continue;
+        }
+        
+        StatType bonusStat = instruction.isPhysical ? StatType::STRENGTH : StatType::INTELLECT;
+        landedDamage += instruction.amount + userStats.GetCurrentStat(bonusStat) / 2;
+    }
+    
+    if (landedDamage <= 0) {
+        return 0.0f;
+    }
+    
+    float hitChance = std::max(0, std::min(100, action.GetAccuracy())) / 100.0f;
+    return hitChance * landedDamage * GetTable(userStats, targetStats).GetExpectedMultiplier();
+}
+
+bool ResolutionEngine::ValidateAgainstLegacyRules(int trialsPerCase) {
+    std::cout << "------- Resolution table validation (" << trialsPerCase 
+              << " trials per case) -------" << std::endl;
+    
+    const int lucks[] = {0, 3, 8, 15, 30};
+    const int defenses[] = {0, 2, 7, 16, 40};
+    const int accuracies[] = {60, 85, 100};
+    
+    int failedCases = 0;
+    int totalCases = 0;
+    
+    for (int luck : lucks) {
+        for (int defense : defenses) {
+            // Fresh stat blocks for this case
+            StatsComponent attacker;
+            attacker.Initialize(10, 10, 10, 10, 10, 0, luck);
+            StatsComponent defender;
+            defender.Initialize(10, 10, 10, 10, 10, defense, 0);
+            
+            int critChance = attacker.CalculateCriticalChance();
+            int blockChance = defender.CalculateBlockChance();
+            const OutcomeTable& table = GetTable(attacker, defender);
+            
+            for (int accuracy : accuracies) {
+                // Exact probabilities of the legacy rules
+                double hit = accuracy / 100.0;
+                double expected[4];
+                expected[static_cast<int>(HitOutcome::MISS)] = 1.0 - hit;
+                expected[static_cast<int>(HitOutcome::BLOCK)] = hit * blockChance / 100.0;
+                expected[static_cast<int>(HitOutcome::CRIT)] = hit * (1.0 - blockChance / 100.0) * critChance / 100.0;
+                expected[static_cast<int>(HitOutcome::HIT)] = hit * (1.0 - blockChance / 100.0) * (1.0 - critChance / 100.0);
+                
+                // The table must encode them exactly
+                bool exact = 
+                    std::abs(hit * table.GetBlockChance() - expected[static_cast<int>(HitOutcome::BLOCK)]) < 1e-6 &&
+                    std::abs(hit * table.GetCritChance() - expected[static_cast<int>(HitOutcome::CRIT)]) < 1e-6;
+                
+                // Sample both the legacy two-roll rules and the single-draw table
+                int legacyCounts[4] = {0, 0, 0, 0};
+                int tableCounts[4] = {0, 0, 0, 0};
+                for (int trial = 0; trial < trialsPerCase; ++trial) {
+                    HitOutcome legacy = HitOutcome::MISS;
+                    if (accuracy >= 100 || std::rand() % 100 + 1 <= accuracy) {
+                        bool crit = (std::rand() % 100 + 1) <= critChance;
+                        bool blocked = std::rand() % 100 < blockChance;
+                        legacy = blocked ? HitOutcome::BLOCK : (crit ? HitOutcome::CRIT : HitOutcome::HIT);
+                    }
+                    legacyCounts[static_cast<int>(legacy)]++;
+                    
+                    HitOutcome sampled = RollAccuracy(accuracy) ? Resolve(attacker, defender) : HitOutcome::MISS;
+                    tableCounts[static_cast<int>(sampled)]++;
+                }
+                
+                // Both empirical distributions must sit within 4 standard errors of the exact one
+                bool withinTolerance = true;
+                for (int outcome = 0; outcome < 4; ++outcome) {
+                    double p = expected[outcome];
+                    double tolerance = 4.0 * std::sqrt(p * (1.0 - p) / trialsPerCase) + 1e-3;
+                    double legacyFreq = static_cast<double>(legacyCounts[outcome]) / trialsPerCase;
+                    double tableFreq = static_cast<double>(tableCounts[outcome]) / trialsPerCase;
+                    if (std::abs(legacyFreq - p) > tolerance || std::abs(tableFreq - p) > tolerance) {
+                        withinTolerance = false;
+                    }
+                }
+                
+                totalCases++;
+                if (!exact || !withinTolerance) {
+                    failedCases++;
+                    std::cout << "  FAIL LCK " << luck << " DEF " << defense << " ACC " << accuracy
+                              << (exact ? "" : " (table mismatch)") << std::endl;
+                }
+            }
+            
+            // The temporary stat blocks are about to go away
+            cache.erase({&attacker, &defender});
+        }
+    }
+    
+    std::cout << "Validation: " << (totalCases - failedCases) << "/" << totalCases 
+              << " cases match the legacy rules" << std::endl;
+    return failedCases == 0;
+}
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include "Action.h"
+#include "../entities/components/StatsComponent.h"
+
+namespace Game {
+
+// Result of resolving one attack against one defender
+enum class HitOutcome : uint8_t {
+    MISS,           // Failed the accuracy roll
+    BLOCK,          // Defender blocked, no damage
+    CRIT,           // Double damage
+    HIT             // Normal damage
+};
+
+// Outcome distribution for an attacker/defender pair, stored as cumulative
+// thresholds so a single uniform draw picks the outcome. Probabilities are
+// conditional on the attack landing; the accuracy roll happens once per action.
+struct OutcomeTable {
+    static const uint32_t SCALE = 10000;    // Draws are uniform in [0, SCALE)
+    
+    uint32_t blockBelow = 0;    // draw < blockBelow            -> BLOCK
+    uint32_t critBelow = 0;     // blockBelow <= draw < critBelow -> CRIT, otherwise HIT
+    
+    // Pick the outcome for a draw in [0, SCALE)
+    HitOutcome Sample(uint32_t draw) const {
+        if (draw < blockBelow) return HitOutcome::BLOCK;
+        if (draw < critBelow) return HitOutcome::CRIT;
+        return HitOutcome::HIT;
+    }
+    
+    // Exact probabilities (given a hit)
+    float GetBlockChance() const { return static_cast<float>(blockBelow) / SCALE; }
+    float GetCritChance() const { return static_cast<float>(critBelow - blockBelow) / SCALE; }
+    float GetHitChance() const { return static_cast<float>(SCALE - critBelow) / SCALE; }
+    
+    // Expected damage multiplier of a landed attack (crits double, blocks negate)
+    float GetExpectedMultiplier() const { return GetHitChance() + 2.0f * GetCritChance(); }
+};
+
+// Resolves hits, crits and blocks from precomputed outcome tables.
+// Tables are cached per attacker/defender pair and rebuilt only when either
+// side's stats version changes. Each combat owns its own engine (see
+// CombatSystem), so parallel simulations share neither the cache nor the
+// random stream, and a seeded combat replays the same rolls.
+class ResolutionEngine {
+public:
+    // Seeded from the clock until Seed is called
+    ResolutionEngine();
+    
+    // Get the outcome table for a pair, rebuilding it if either side's stats changed
+    const OutcomeTable& GetTable(const StatsComponent& attacker, const StatsComponent& defender);
+    
+    // Roll an action's accuracy (1-100 against the accuracy percentage)
+    bool RollAccuracy(int accuracy);
+    
+    // Uniform roll in 1-100 for other percentage checks (e.g. escaping)
+    int RollPercent();
+    
+    // Resolve a landed attack with a single draw
+    HitOutcome Resolve(const StatsComponent& attacker, const StatsComponent& defender);
+    
+    // Exact expected damage of an action on a target, including accuracy (no sampling)
+    float ExpectedDamage(const Action& action, const Entity* user, const Entity* target);
+    
+    // Compare table sampling against the legacy two-roll rules over a grid of
+    // LCK/DEF values; returns true if every case is within tolerance
+    bool ValidateAgainstLegacyRules(int trialsPerCase = 20000);
+    
+    // Drop all cached tables (e.g. when this engine's combat ends)
+    void ClearCache() { cache.clear(); }
+    
+    // Number of cached pairs
+    size_t GetCacheSize() const { return cache.size(); }
+    
+    // Reseed the random number generator
+    void Seed(uint32_t seed) { rng.seed(seed); }
+    
+private:
+    // Build a table from the current stats of both sides
+    static OutcomeTable BuildTable(const StatsComponent& attacker, const StatsComponent& defender);
+    
+    // Cached table with the stats versions it was built from
+    struct CacheEntry {
+        uint64_t attackerVersion = 0;
+        uint64_t defenderVersion = 0;
+        OutcomeTable table;
+    };
+    
+    // Hash for attacker/defender pointer pairs
+    struct PairHash {
+        size_t operator()(const std::pair<const StatsComponent*, const StatsComponent*>& key) const {
+            return std::hash<const void*>()(key.first) ^ (std::hash<const void*>()(key.second) << 1);
+        }
+    };
+    
+    std::unordered_map<std::pair<const StatsComponent*, const StatsComponent*>, CacheEntry, PairHash> cache;
+    
+    // Random number generator for all combat rolls
+    std::mt19937 rng;
+};
+
+} // namespace Game 
\ No newline at end of file
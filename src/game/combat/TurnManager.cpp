@@ -2,6 +2,7 @@
 #include "Battlefield.h"
 #include "../entities/components/StatsComponent.h"
 #include "../entities/components/PositionComponent.h"
+#include "CombatLog.h"
 #include <iostream>
 #include <algorithm>
 
@@ -24,7 +25,7 @@ void TurnManager::Initialize(const std::vector<std::shared_ptr<Entity>>& entitie
     currentEntity = nullptr;
     currentRound = 1;
     
-    std::cout << "------- Starting Round " << currentRound << " -------" << std::endl;
+    CombatLog::Out() << "------- Starting Round " << currentRound << " -------" << std::endl;
     
     // Add all active entities to the queue based on speed
     for (const auto& entity : entities) {
@@ -49,25 +50,26 @@ void TurnManager::Initialize(const std::vector<std::shared_ptr<Entity>>& entitie
         turnQueue.pop();
         currentEntity = nextTurn.entity;
         
-        std::cout << "Turn begins for " << currentEntity->GetName() 
-                  << " (Speed: " << nextTurn.initiative << ")" << std::endl;
+        CombatLog::Out() << "Turn begins for " << currentEntity->GetName() 
+                         << " (Speed: " << nextTurn.initiative << ")" << std::endl;
     }
 }
 
 std::shared_ptr<Entity> TurnManager::GetNextEntity() {
+    // Start the next round once every entity has acted, so the round
+    // counter advances when the new round actually begins
+    if (!currentEntity && turnQueue.empty() && !entitiesInCurrentRound.empty()) {
+        PrepareNextRound();
+    }
+    
     // If there's no current entity, get the next one from the queue
     if (!currentEntity && !turnQueue.empty()) {
         Turn nextTurn = turnQueue.top();
         turnQueue.pop();
         currentEntity = nextTurn.entity;
         
-        std::cout << "Turn begins for " << currentEntity->GetName() 
-                  << " (Speed: " << nextTurn.initiative << ")" << std::endl;
-        
-        // Check if we've completed a round (all entities have acted)
-        if (turnQueue.empty()) {
-            PrepareNextRound();
-        }
+        CombatLog::Out() << "Turn begins for " << currentEntity->GetName() 
+                         << " (Speed: " << nextTurn.initiative << ")" << std::endl;
     }
     
     return currentEntity;
@@ -83,9 +85,9 @@ void TurnManager::EndTurn() {
         
         // Only proceed if entity is still alive
         if (!stats.IsDead()) {
-            std::cout << currentEntity->GetName() << "'s turn ends." << std::endl;
+            CombatLog::Out() << currentEntity->GetName() << "'s turn ends." << std::endl;
         } else {
-            std::cout << currentEntity->GetName() << " is defeated and removed from turn order." << std::endl;
+            CombatLog::Out() << currentEntity->GetName() << " is defeated and removed from turn order." << std::endl;
             
             // Remove from entities in current round
             auto it = std::find(entitiesInCurrentRound.begin(), entitiesInCurrentRound.end(), currentEntity);
@@ -186,7 +188,7 @@ bool TurnManager::IsEntityOnPlayerSide(const Entity* entity) const {
 
 void TurnManager::PrepareNextRound() {
     currentRound++;
-    std::cout << "------- Round " << currentRound << " begins -------" << std::endl;
+    CombatLog::Out() << "------- Round " << currentRound << " begins -------" << std::endl;
     
     // Re-add all active entities to the queue for the next round
     for (const auto& entity : entitiesInCurrentRound) {
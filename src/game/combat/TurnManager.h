@@ -55,6 +55,9 @@ public:
     // Get the queue size
     size_t GetQueueSize() const;
     
+    // Get the current round number (1-based, 0 before combat starts)
+    int GetCurrentRound() const { return currentRound; }
+    
     // Get all entities in the turn order for display
     std::vector<std::shared_ptr<Entity>> GetTurnOrder() const;
     
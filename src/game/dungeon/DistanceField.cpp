@@ -0,0 +1,274 @@
+#include "DistanceField.h"
+#include "DungeonFloor.h"
+#include <algorithm>
+#include <queue>
+#include <functional>
+#include <utility>
+
+namespace Game {
+
+DistanceField::DistanceField()
+    : sources{DungeonFloor::NO_ROOM, DungeonFloor::NO_ROOM, DungeonFloor::NO_ROOM},
+      markStamp(0) {
+}
+
+void DistanceField::Build(const DungeonFloor& floor) {
+    sources[static_cast<int>(DistanceLane::ENTRANCE)] = floor.GetEntranceIndex();
+    sources[static_cast<int>(DistanceLane::EXIT)] = floor.GetExitIndex();
+    sources[static_cast<int>(DistanceLane::BOSS)] = floor.GetBossIndex();
+
+    distances.assign(static_cast<size_t>(floor.GetRoomCount()) * LANE_COUNT, UNREACHABLE);
+    BuildLanes(floor, (1u << LANE_COUNT) - 1);
+}
+
+void DistanceField::BuildLanes(const DungeonFloor& floor, uint8_t laneMask) {
+    const int roomCount = floor.GetRoomCount();
+
+    // Lanes outside the mask count as already seen everywhere
+    std::vector<uint8_t> seen(roomCount, static_cast<uint8_t>(~laneMask));
+    std::vector<uint8_t> frontierMask(roomCount, 0);
+    std::vector<uint8_t> nextMask(roomCount, 0);
+    std::vector<int> frontier;
+    std::vector<int> next;
+
+    for (int lane = 0; lane < LANE_COUNT; ++lane) {
+        if (!(laneMask & (1u << lane))) {
+            continue;
+        }
+
+        for (int room = 0; room < roomCount; ++room) {
+            At(room, lane) = UNREACHABLE;
+        }
+
+        int source = sources[lane];
+        if (!floor.IsValidRoom(source)) {
+            continue;
+        }
+
+        At(source, lane) = 0;
+        seen[source] |= static_cast<uint8_t>(1u << lane);
+        if (frontierMask[source] == 0) {
+            frontier.push_back(source);
+        }
+        frontierMask[source] |= static_cast<uint8_t>(1u << lane);
+    }
+
+    // Level-synchronous expansion: each room carries the lanes that reached
+    // it this level, so shared corridors are walked once for all lanes
+    for (int level = 1; !frontier.empty(); ++level) {
+        for (int room : frontier) {
+            uint8_t arriving = frontierMask[room];
+            frontierMask[room] = 0;
+
+            for (int neighbor : floor.GetNeighbors(room)) {
+                uint8_t fresh = arriving & static_cast<uint8_t>(~seen[neighbor]);
+                if (fresh == 0) {
+                    continue;
+                }
+
+                seen[neighbor] |= fresh;
+                for (int lane = 0; lane < LANE_COUNT; ++lane) {
+                    if (fresh & (1u << lane)) {
+                        At(neighbor, lane) = level;
+                    }
+                }
+
+                if (nextMask[neighbor] == 0) {
+                    next.push_back(neighbor);
+                }
+                nextMask[neighbor] |= fresh;
+            }
+        }
+
+        frontier.swap(next);
+        frontierMask.swap(nextMask);
+        next.clear();
+    }
+}
+
+void DistanceField::OnRoomAdded() {
+    distances.insert(distances.end(), LANE_COUNT, UNREACHABLE);
+}
+
+void DistanceField::OnConnected(const DungeonFloor& floor, int a, int b) {
+    for (int lane = 0; lane < LANE_COUNT; ++lane) {
+        int distA = At(a, lane);
+        int distB = At(b, lane);
+
+        // A new door can only shorten paths through its farther end
+        if (distA != UNREACHABLE && (distB == UNREACHABLE || distA + 1 < distB)) {
+            At(b, lane) = distA + 1;
+            Relax(floor, lane, b);
+        } else if (distB != UNREACHABLE && (distA == UNREACHABLE || distB + 1 < distA)) {
+            At(a, lane) = distB + 1;
+            Relax(floor, lane, a);
+        }
+    }
+}
+
+void DistanceField::OnDisconnected(const DungeonFloor& floor, int a, int b) {
+    for (int lane = 0; lane < LANE_COUNT; ++lane) {
+        int distA = At(a, lane);
+        int distB = At(b, lane);
+        if (distA == UNREACHABLE || distB == UNREACHABLE || distA == distB) {
+            continue;
+        }
+
+        // The farther end only moves if the removed door was its last way in
+        int farther = distA > distB ? a : b;
+        if (!HasParent(floor, lane, farther)) {
+            Repair(floor, lane, farther);
+        }
+    }
+}
+
+void DistanceField::Relax(const DungeonFloor& floor, int lane, int start) {
+    // Improvements all stem from one room, so FIFO order settles each room once
+    std::vector<int> queue;
+    queue.push_back(start);
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int room = queue[head];
+        int nextDistance = At(room, lane) + 1;
+
+        floor.ForEachNeighbor(room, [&](int neighbor) {
+            int& current = At(neighbor, lane);
+            if (current == UNREACHABLE || nextDistance < current) {
+                current = nextDistance;
+                queue.push_back(neighbor);
+            }
+        });
+    }
+}
+
+void DistanceField::Repair(const DungeonFloor& floor, int lane, int start) {
+    if (marks.size() < distances.size() / LANE_COUNT) {
+        marks.resize(distances.size() / LANE_COUNT, 0);
+    }
+    if (++markStamp == 0) {
+        std::fill(marks.begin(), marks.end(), 0);
+        markStamp = 1;
+    }
+
+    // Collect the affected rooms level by level: a child joins once none of
+    // its parents lie outside the set. Every parent of a level is known
+    // before that level is examined, since rooms are taken in FIFO order.
+    std::vector<int> affected;
+    affected.push_back(start);
+    marks[start] = markStamp;
+
+    for (size_t head = 0; head < affected.size(); ++head) {
+        int room = affected[head];
+        int childDistance = At(room, lane) + 1;
+
+        floor.ForEachNeighbor(room, [&](int child) {
+            if (marks[child] == markStamp || At(child, lane) != childDistance) {
+                return;
+            }
+
+            bool supported = false;
+            floor.ForEachNeighbor(child, [&](int parent) {
+                if (marks[parent] != markStamp && At(parent, lane) == childDistance - 1) {
+                    supported = true;
+                }
+            });
+
+            if (!supported) {
+                marks[child] = markStamp;
+                affected.push_back(child);
+            }
+        });
+    }
+
+    // Seed each affected room from its best unaffected neighbour...
+    using Entry = std::pair<int, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+    for (int room : affected) {
+        int best = UNREACHABLE;
+        floor.ForEachNeighbor(room, [&](int neighbor) {
+            int distance = At(neighbor, lane);
+            if (marks[neighbor] != markStamp && distance != UNREACHABLE &&
+                (best == UNREACHABLE || distance + 1 < best)) {
+                best = distance + 1;
+            }
+        });
+
+        At(room, lane) = best;
+        if (best != UNREACHABLE) {
+            open.push(Entry(best, room));
+        }
+    }
+
+    // ...then settle the set in distance order; rooms left without a seed
+    // were cut off from the source
+    while (!open.empty()) {
+        Entry entry = open.top();
+        open.pop();
+        if (entry.first != At(entry.second, lane)) {
+            continue;
+        }
+
+        int nextDistance = entry.first + 1;
+        floor.ForEachNeighbor(entry.second, [&](int neighbor) {
+            int& current = At(neighbor, lane);
+            if (marks[neighbor] == markStamp && (current == UNREACHABLE || nextDistance < current)) {
+                current = nextDistance;
+                open.push(Entry(nextDistance, neighbor));
+            }
+        });
+    }
+}
+
+bool DistanceField::HasParent(const DungeonFloor& floor, int lane, int room) const {
+    int wanted = At(room, lane) - 1;
+    bool found = false;
+
+    floor.ForEachNeighbor(room, [&](int neighbor) {
+        if (At(neighbor, lane) == wanted) {
+            found = true;
+        }
+    });
+
+    return found;
+}
+
+int DistanceField::GetFarthest(DistanceLane lane) const {
+    int farthest = 0;
+    for (size_t i = static_cast<size_t>(lane); i < distances.size(); i += LANE_COUNT) {
+        farthest = std::max(farthest, distances[i]);
+    }
+    return farthest;
+}
+
+int DistanceField::GetReachedCount(DistanceLane lane) const {
+    int reached = 0;
+    for (size_t i = static_cast<size_t>(lane); i < distances.size(); i += LANE_COUNT) {
+        if (distances[i] != UNREACHABLE) {
+            reached++;
+        }
+    }
+    return reached;
+}
+
+int DistanceField::NextStepToward(const DungeonFloor& floor, DistanceLane lane, int room) const {
+    if (!floor.IsValidRoom(room)) {
+        return DungeonFloor::NO_ROOM;
+    }
+
+    int distance = GetDistance(lane, room);
+    if (distance == UNREACHABLE || distance == 0) {
+        return DungeonFloor::NO_ROOM;
+    }
+
+    // First neighbour in adjacency order, so hints are stable between frames
+    for (int neighbor : floor.GetNeighbors(room)) {
+        if (GetDistance(lane, neighbor) == distance - 1) {
+            return neighbor;
+        }
+    }
+
+    return DungeonFloor::NO_ROOM;
+}
+
+} // namespace Game 
\ No newline at end of file
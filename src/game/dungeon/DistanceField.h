@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Game {
+
+class DungeonFloor;
+
+/**
+ * Rooms a distance field measures walking distance from
+ */
+enum class DistanceLane : int {
+    ENTRANCE = 0,
+    EXIT,
+    BOSS
+};
+
+/**
+ * Walking distances (in doors) from the entrance, exit and boss rooms.
+ *
+ * All lanes are filled by one breadth-first pass over the floor graph: every
+ * frontier entry carries a small bitmask of the lanes that reached it, so a
+ * room is expanded at most once per level no matter how many lanes are
+ * active. Distances are stored interleaved per room, so the lanes of one
+ * room share a cache line.
+ *
+ * The field follows connection changes incrementally. A new connection can
+ * only shorten paths, which is propagated outwards from the improved end.
+ * A removed connection only matters to a lane if it was the sole shortest
+ * route into one of its rooms; then only the rooms that depended on it are
+ * re-settled from the unaffected rooms around them.
+ */
+class DistanceField {
+public:
+    static constexpr int LANE_COUNT = 3;
+    static constexpr int UNREACHABLE = -1;
+
+    DistanceField();
+
+    // Compute every lane from the floor's current special rooms
+    void Build(const DungeonFloor& floor);
+
+    // Keep the field in step with a connection change on the floor
+    void OnConnected(const DungeonFloor& floor, int a, int b);
+    void OnDisconnected(const DungeonFloor& floor, int a, int b);
+
+    // A room without connections was appended to the floor
+    void OnRoomAdded();
+
+    // Distance of a room from the lane's source (UNREACHABLE if none)
+    int GetDistance(DistanceLane lane, int room) const {
+        return distances[static_cast<size_t>(room) * LANE_COUNT + static_cast<int>(lane)];
+    }
+    bool IsReachable(DistanceLane lane, int room) const { return GetDistance(lane, room) != UNREACHABLE; }
+
+    // Room the lane is measured from (-1 if the floor has no such room)
+    int GetSource(DistanceLane lane) const { return sources[static_cast<int>(lane)]; }
+
+    // Largest finite distance in a lane and the number of rooms it reaches
+    int GetFarthest(DistanceLane lane) const;
+    int GetReachedCount(DistanceLane lane) const;
+
+    /**
+     * Neighbour of a room that is one door closer to the lane's source, for
+     * map hints and auto-travel. Returns -1 at the source or when the source
+     * cannot be reached from the room.
+     */
+    int NextStepToward(const DungeonFloor& floor, DistanceLane lane, int room) const;
+
+    // Heap bytes held by the field
+    size_t GetMemoryUsage() const {
+        return distances.capacity() * sizeof(int) + marks.capacity() * sizeof(uint32_t);
+    }
+
+private:
+    int& At(int room, int lane) { return distances[static_cast<size_t>(room) * LANE_COUNT + lane]; }
+    int At(int room, int lane) const { return distances[static_cast<size_t>(room) * LANE_COUNT + lane]; }
+
+    // Multi-lane breadth-first pass over the lanes in the mask
+    void BuildLanes(const DungeonFloor& floor, uint8_t laneMask);
+
+    // Push a shortened distance outwards from one room in one lane
+    void Relax(const DungeonFloor& floor, int lane, int start);
+
+    // Re-settle the rooms whose shortest routes all ran through a room that
+    // lost its last way in
+    void Repair(const DungeonFloor& floor, int lane, int start);
+
+    // Whether a room still has a neighbour one door closer to the source
+    bool HasParent(const DungeonFloor& floor, int lane, int room) const;
+
+    int sources[LANE_COUNT];
+    std::vector<int> distances;
+
+    // Scratch marks for Repair, compared against a stamp so they never
+    // need clearing between calls
+    std::vector<uint32_t> marks;
+    uint32_t markStamp;
+};
+
+} // namespace Game 
\ No newline at end of file
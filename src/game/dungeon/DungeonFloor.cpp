@@ -0,0 +1,310 @@
+#include "DungeonFloor.h"
+#include <algorithm>
+
+namespace Game {
+
+DungeonFloor::DungeonFloor()
+    : DungeonFloor(0, 0) {
+}
+
+DungeonFloor::DungeonFloor(int width, int height)
+    : width(0),
+      height(0),
+      seed(0),
+      entranceIndex(NO_ROOM),
+      exitIndex(NO_ROOM),
+      bossIndex(NO_ROOM),
+      adjacencyDirty(true),
+      distancesDirty(true) {
+    Reset(width, height);
+}
+
+void DungeonFloor::Reset(int newWidth, int newHeight) {
+    width = std::max(newWidth, 0);
+    height = std::max(newHeight, 0);
+
+    cells.assign(static_cast<size_t>(width) * height, NO_ROOM);
+    rooms.clear();
+    doors.clear();
+    edges.clear();
+    longRangeEdges.clear();
+    seed = 0;
+
+    entranceIndex = NO_ROOM;
+    exitIndex = NO_ROOM;
+    bossIndex = NO_ROOM;
+
+    adjacencyOffsets.clear();
+    adjacencyTargets.clear();
+    adjacencyDirty = true;
+    distancesDirty = true;
+}
+
+int DungeonFloor::AddRoom(RoomType type, int x, int y) {
+    if (!InBounds(x, y) || cells[ToCell(x, y)] != NO_ROOM) {
+        return NO_ROOM;
+    }
+
+    int index = static_cast<int>(rooms.size());
+    rooms.emplace_back(index, type);
+    rooms.back().SetPosition(x, y);
+    doors.push_back(0);
+    cells[ToCell(x, y)] = index;
+
+    if (!distancesDirty) {
+        distanceField.OnRoomAdded();
+    }
+    UpdateSpecialIndex(index, RoomType::NORMAL, type);
+    adjacencyDirty = true;
+    return index;
+}
+
+void DungeonFloor::SetRoomType(int index, RoomType type) {
+    if (!IsValidRoom(index)) {
+        return;
+    }
+
+    RoomType oldType = rooms[index].GetType();
+    rooms[index].SetType(type);
+    UpdateSpecialIndex(index, oldType, type);
+}
+
+void DungeonFloor::UpdateSpecialIndex(int index, RoomType oldType, RoomType newType) {
+    int oldEntrance = entranceIndex;
+    int oldExit = exitIndex;
+    int oldBoss = bossIndex;
+
+    // Forget the old role if this room held it
+    if (oldType == RoomType::ENTRANCE && entranceIndex == index) entranceIndex = NO_ROOM;
+    if (oldType == RoomType::EXIT && exitIndex == index) exitIndex = NO_ROOM;
+    if (oldType == RoomType::BOSS && bossIndex == index) bossIndex = NO_ROOM;
+
+    switch (newType) {
+        case RoomType::ENTRANCE: entranceIndex = index; break;
+        case RoomType::EXIT: exitIndex = index; break;
+        case RoomType::BOSS: bossIndex = index; break;
+        default: break;
+    }
+
+    // A moved source invalidates its whole lane
+    if (entranceIndex != oldEntrance || exitIndex != oldExit || bossIndex != oldBoss) {
+        distancesDirty = true;
+    }
+}
+
+int DungeonFloor::DoorBetween(int a, int b) const {
+    // Door bit on room a leading to room b, or -1 if they are not grid neighbours
+    int dx = rooms[b].GetPositionX() - rooms[a].GetPositionX();
+    int dy = rooms[b].GetPositionY() - rooms[a].GetPositionY();
+
+    if (dy == 0 && dx == 1) return 0;
+    if (dx == 0 && dy == 1) return 1;
+    if (dy == 0 && dx == -1) return 2;
+    if (dx == 0 && dy == -1) return 3;
+    return -1;
+}
+
+bool DungeonFloor::Connect(int a, int b) {
+    if (!IsValidRoom(a) || !IsValidRoom(b) || a == b || AreConnected(a, b)) {
+        return false;
+    }
+
+    int door = DoorBetween(a, b);
+    if (door >= 0) {
+        doors[a] |= static_cast<uint8_t>(1u << door);
+        doors[b] |= static_cast<uint8_t>(1u << ((door + 2) & 3));
+    } else {
+        longRangeEdges.emplace_back(std::min(a, b), std::max(a, b));
+    }
+
+    edges.emplace_back(std::min(a, b), std::max(a, b));
+    adjacencyDirty = true;
+
+    if (!distancesDirty) {
+        distanceField.OnConnected(*this, a, b);
+    }
+    return true;
+}
+
+bool DungeonFloor::Disconnect(int a, int b) {
+    if (!IsValidRoom(a) || !IsValidRoom(b)) {
+        return false;
+    }
+
+    auto edge = std::make_pair(std::min(a, b), std::max(a, b));
+    auto it = std::find(edges.begin(), edges.end(), edge);
+    if (it == edges.end()) {
+        return false;
+    }
+
+    int door = DoorBetween(a, b);
+    if (door >= 0) {
+        doors[a] &= static_cast<uint8_t>(~(1u << door));
+        doors[b] &= static_cast<uint8_t>(~(1u << ((door + 2) & 3)));
+    } else {
+        longRangeEdges.erase(std::find(longRangeEdges.begin(), longRangeEdges.end(), edge));
+    }
+
+    edges.erase(it);
+    adjacencyDirty = true;
+
+    if (!distancesDirty) {
+        distanceField.OnDisconnected(*this, a, b);
+    }
+    return true;
+}
+
+bool DungeonFloor::AreConnected(int a, int b) const {
+    if (!IsValidRoom(a) || !IsValidRoom(b)) {
+        return false;
+    }
+
+    // Grid neighbours answer from the door mask
+    int door = DoorBetween(a, b);
+    if (door >= 0) {
+        return (doors[a] >> door) & 1u;
+    }
+
+    // Long-range links are rare (hand-built floors, validation fixes),
+    // so a scan of their short list is enough for them
+    auto edge = std::make_pair(std::min(a, b), std::max(a, b));
+    return std::find(longRangeEdges.begin(), longRangeEdges.end(), edge) != longRangeEdges.end();
+}
+
+NeighborRange DungeonFloor::GetNeighbors(int index) const {
+    if (adjacencyDirty) {
+        RebuildAdjacency();
+    }
+
+    if (!IsValidRoom(index)) {
+        return NeighborRange{nullptr, nullptr};
+    }
+
+    const int* base = adjacencyTargets.data();
+    return NeighborRange{base + adjacencyOffsets[index], base + adjacencyOffsets[index + 1]};
+}
+
+void DungeonFloor::RebuildAdjacency() const {
+    const size_t roomCount = rooms.size();
+
+    // Count degrees, then prefix-sum into offsets
+    adjacencyOffsets.assign(roomCount + 1, 0);
+    for (const auto& edge : edges) {
+        adjacencyOffsets[edge.first + 1]++;
+        adjacencyOffsets[edge.second + 1]++;
+    }
+    for (size_t i = 0; i < roomCount; ++i) {
+        adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+    }
+
+    // Scatter both directions of every edge, keeping insertion order per room
+    adjacencyTargets.resize(edges.size() * 2);
+    std::vector<int> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (const auto& edge : edges) {
+        adjacencyTargets[cursor[edge.first]++] = edge.second;
+        adjacencyTargets[cursor[edge.second]++] = edge.first;
+    }
+
+    adjacencyDirty = false;
+}
+
+const DistanceField& DungeonFloor::GetDistanceField() const {
+    if (distancesDirty) {
+        distanceField.Build(*this);
+        distancesDirty = false;
+    }
+    return distanceField;
+}
+
+size_t DungeonFloor::GetMemoryUsage() const {
+    size_t bytes = sizeof(DungeonFloor);
+    bytes += cells.capacity() * sizeof(int);
+    bytes += rooms.capacity() * sizeof(Room);
+    bytes += doors.capacity() * sizeof(uint8_t);
+    bytes += (edges.capacity() + longRangeEdges.capacity()) * sizeof(std::pair<int, int>);
+    bytes += (adjacencyOffsets.capacity() + adjacencyTargets.capacity()) * sizeof(int);
+    bytes += distanceField.GetMemoryUsage();
+
+    // Descriptions and property texts live in the string interner and are
+    // not counted here; a materialized encounter is counted at its object
+    // size only
+    for (const Room& room : rooms) {
+        bytes += room.GetPropertyCount() * sizeof(std::pair<Engine::StringId, Engine::StringId>);
+        if (room.IsEncounterMaterialized()) {
+            bytes += sizeof(Encounter);
+        }
+    }
+
+    return bytes;
+}
+
+int DungeonFloor::ComputeDistances(int source, std::vector<int>& distances) const {
+    distances.assign(rooms.size(), -1);
+    if (!IsValidRoom(source)) {
+        return 0;
+    }
+
+    if (adjacencyDirty) {
+        RebuildAdjacency();
+    }
+
+    // The queue never holds more than one entry per room
+    std::vector<int> queue(rooms.size());
+    size_t head = 0;
+    size_t tail = 0;
+
+    queue[tail++] = source;
+    distances[source] = 0;
+
+    while (head < tail) {
+        int current = queue[head++];
+        int nextDistance = distances[current] + 1;
+
+        for (int i = adjacencyOffsets[current]; i < adjacencyOffsets[current + 1]; ++i) {
+            int neighbor = adjacencyTargets[i];
+            if (distances[neighbor] < 0) {
+                distances[neighbor] = nextDistance;
+                queue[tail++] = neighbor;
+            }
+        }
+    }
+
+    return static_cast<int>(tail);
+}
+
+int DungeonFloor::MarkReachable(int source, std::vector<uint64_t>& reachable) const {
+    reachable.assign((rooms.size() + 63) / 64, 0);
+    if (!IsValidRoom(source)) {
+        return 0;
+    }
+
+    if (adjacencyDirty) {
+        RebuildAdjacency();
+    }
+
+    // Depth-first flood over the CSR arrays; the stack holds each room once
+    std::vector<int> stack;
+    stack.reserve(rooms.size());
+    stack.push_back(source);
+    reachable[source >> 6] |= 1ULL << (source & 63);
+    int reached = 1;
+
+    while (!stack.empty()) {
+        int current = stack.back();
+        stack.pop_back();
+
+        for (int i = adjacencyOffsets[current]; i < adjacencyOffsets[current + 1]; ++i) {
+            int neighbor = adjacencyTargets[i];
+            uint64_t bit = 1ULL << (neighbor & 63);
+            if (!(reachable[neighbor >> 6] & bit)) {
+                reachable[neighbor >> 6] |= bit;
+                stack.push_back(neighbor);
+                reached++;
+            }
+        }
+    }
+
+    return reached;
+}
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Room.h"
+#include "DistanceField.h"
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace Game {
+
+/**
+ * Read-only view over one room's slice of the adjacency array
+ */
+struct NeighborRange {
+    const int* first;
+    const int* last;
+
+    const int* begin() const { return first; }
+    const int* end() const { return last; }
+    int size() const { return static_cast<int>(last - first); }
+    bool empty() const { return first == last; }
+};
+
+/**
+ * Dense representation of a single dungeon floor.
+ *
+ * Rooms live by value in one contiguous table and are addressed by index
+ * (a room's index is also its id). The layout is a flat width*height grid
+ * of room indices (-1 for empty cells) and the connections are stored as
+ * an undirected edge list that is compiled into a CSR adjacency structure
+ * (offsets + targets) on first use after a change. Generation, traversal
+ * and rendering therefore only walk integer arrays.
+ *
+ * Connections between grid neighbours are also recorded as a 4-bit door
+ * mask per room, which makes connection tests O(1) while a floor is built.
+ *
+ * Walking distances from the special rooms are computed on first request
+ * and then kept current as connections change (see DistanceField).
+ */
+class DungeonFloor {
+public:
+    static constexpr int NO_ROOM = -1;
+
+    DungeonFloor();
+    DungeonFloor(int width, int height);
+
+    // Drop all rooms and connections and resize the grid
+    void Reset(int width, int height);
+
+    // Grid
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+    bool InBounds(int x, int y) const { return x >= 0 && x < width && y >= 0 && y < height; }
+    int ToCell(int x, int y) const { return y * width + x; }
+    int GetRoomAt(int x, int y) const { return InBounds(x, y) ? cells[ToCell(x, y)] : NO_ROOM; }
+    const std::vector<int>& GetCells() const { return cells; }
+
+    // Room table
+    int AddRoom(RoomType type, int x, int y);
+    int GetRoomCount() const { return static_cast<int>(rooms.size()); }
+    void ReserveRooms(int count) { rooms.reserve(count); doors.reserve(count); }
+    bool IsValidRoom(int index) const { return index >= 0 && index < static_cast<int>(rooms.size()); }
+    Room& GetRoom(int index) { return rooms[index]; }
+    const Room& GetRoom(int index) const { return rooms[index]; }
+    std::vector<Room>& GetRooms() { return rooms; }
+    const std::vector<Room>& GetRooms() const { return rooms; }
+    bool IsEmpty() const { return rooms.empty(); }
+
+    // Seed the floor was generated from (0 for hand-built floors)
+    uint64_t GetSeed() const { return seed; }
+    void SetSeed(uint64_t newSeed) { seed = newSeed; }
+    
+    // Special rooms (NO_ROOM if absent)
+    int GetEntranceIndex() const { return entranceIndex; }
+    int GetExitIndex() const { return exitIndex; }
+    int GetBossIndex() const { return bossIndex; }
+    void SetRoomType(int index, RoomType type);
+
+    // Connections
+    bool Connect(int a, int b);
+    bool Disconnect(int a, int b);
+    bool AreConnected(int a, int b) const;
+    NeighborRange GetNeighbors(int index) const;
+    int GetConnectionCount() const { return static_cast<int>(edges.size()); }
+    uint8_t GetDoors(int index) const { return doors[index]; }
+    const std::vector<std::pair<int, int>>& GetConnections() const { return edges; }
+
+    /**
+     * Visit the neighbours of a room. Uses the door masks while the CSR
+     * arrays are stale, so code reacting to a single connection change
+     * stays proportional to the room's degree.
+     */
+    template <typename Visitor>
+    void ForEachNeighbor(int index, Visitor visit) const;
+
+    /**
+     * Walking distances from the entrance, exit and boss rooms. Built on
+     * first use and updated incrementally by Connect/Disconnect.
+     */
+    const DistanceField& GetDistanceField() const;
+
+    /**
+     * Approximate bytes held by the floor (tables, strings and live
+     * encounters), used to keep multi-floor runs within a memory budget
+     */
+    size_t GetMemoryUsage() const;
+
+    /**
+     * Breadth-first distances (in doors) from a source room.
+     * Unreachable rooms get -1. Returns the number of rooms reached.
+     */
+    int ComputeDistances(int source, std::vector<int>& distances) const;
+    
+    /**
+     * Mark every room reachable from a source in a bitset (one bit per room,
+     * 64 rooms per word). Returns the number of rooms reached.
+     */
+    int MarkReachable(int source, std::vector<uint64_t>& reachable) const;
+    static bool IsMarked(const std::vector<uint64_t>& bits, int index) {
+        return (bits[index >> 6] >> (index & 63)) & 1ULL;
+    }
+
+private:
+    void RebuildAdjacency() const;
+    void UpdateSpecialIndex(int index, RoomType oldType, RoomType newType);
+    int DoorBetween(int a, int b) const;
+
+    int width;
+    int height;
+    uint64_t seed;
+
+    // Flat grid of room indices
+    std::vector<int> cells;
+
+    // Room table
+    std::vector<Room> rooms;
+    int entranceIndex;
+    int exitIndex;
+    int bossIndex;
+
+    // Door bits per room (right, down, left, up) for grid-adjacent links
+    std::vector<uint8_t> doors;
+    
+    // Undirected edges stored with first < second, in insertion order
+    std::vector<std::pair<int, int>> edges;
+
+    // Connections between rooms that are not grid neighbours (no door
+    // bit); rare, so they are also kept in their own short list
+    std::vector<std::pair<int, int>> longRangeEdges;
+
+    // CSR adjacency compiled from edges
+    mutable std::vector<int> adjacencyOffsets;
+    mutable std::vector<int> adjacencyTargets;
+    mutable bool adjacencyDirty;
+
+    // Distances from the special rooms, valid while distancesDirty is false
+    mutable DistanceField distanceField;
+    mutable bool distancesDirty;
+};
+
+template <typename Visitor>
+void DungeonFloor::ForEachNeighbor(int index, Visitor visit) const {
+    if (!adjacencyDirty) {
+        for (int neighbor : GetNeighbors(index)) {
+            visit(neighbor);
+        }
+        return;
+    }
+
+    // Door bits: right, down, left, up
+    const Room& room = rooms[index];
+    int cell = ToCell(room.GetPositionX(), room.GetPositionY());
+    uint8_t mask = doors[index];
+    if (mask & 1u) visit(cells[cell + 1]);
+    if (mask & 2u) visit(cells[cell + width]);
+    if (mask & 4u) visit(cells[cell - 1]);
+    if (mask & 8u) visit(cells[cell - width]);
+
+    for (const auto& edge : longRangeEdges) {
+        if (edge.first == index) {
+            visit(edge.second);
+        } else if (edge.second == index) {
+            visit(edge.first);
+        }
+    }
+}
+
+} // namespace Game 
\ No newline at end of file
@@ -1,51 +1,78 @@
 #include "DungeonGenerator.h"
-#include "encounters/CombatEncounter.h"
-#include "encounters/TreasureEncounter.h"
 #include <iostream>
 #include <algorithm>
-#include <queue>
-#include <stack>
+#include <limits>
 #include <random>
-#include <chrono>
-#include <sstream>
 
 namespace Game {
 
-// Initialize singleton instance
+namespace {
+
+// Possible directions (right, down, left, up)
+const int DIR_X[4] = {1, 0, -1, 0};
+const int DIR_Y[4] = {0, 1, 0, -1};
+
+// Wave function collapse layouts that fall short of the room count are
+// generated again, up to this many times
+const int MAX_COLLAPSE_ATTEMPTS = 8;
+
+// All 24 orderings of the four directions; the random walk picks one with a
+// single draw instead of shuffling a direction list every step
+const uint8_t DIRECTION_ORDERS[24][4] = {
+    {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 1, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {0, 3, 2, 1},
+    {1, 0, 2, 3}, {1, 0, 3, 2}, {1, 2, 0, 3}, {1, 2, 3, 0}, {1, 3, 0, 2}, {1, 3, 2, 0},
+    {2, 0, 1, 3}, {2, 0, 3, 1}, {2, 1, 0, 3}, {2, 1, 3, 0}, {2, 3, 0, 1}, {2, 3, 1, 0},
+    {3, 0, 1, 2}, {3, 0, 2, 1}, {3, 1, 0, 2}, {3, 1, 2, 0}, {3, 2, 0, 1}, {3, 2, 1, 0}
+};
+
+} // namespace
+
+// Shared instance used by interactive callers
 DungeonGenerator& DungeonGenerator::GetInstance() {
     static DungeonGenerator instance;
     return instance;
 }
 
 DungeonGenerator::DungeonGenerator()
-    : rng(std::random_device()()) {
-    // Seed random generator with current time
-    rng.seed(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count()));
+    : verbose(true) {
+    // Engines are reseeded from the floor seed on every GenerateFloor call;
+    // the collapse's tile weights are the same for every floor
+    collapseSolver.SetWeights(WaveFunctionCollapse::MakeRoomWeights());
 }
 
 void DungeonGenerator::Clear() {
-    rooms.clear();
-    entranceRoom = nullptr;
-    exitRoom = nullptr;
-    bossRoom = nullptr;
-    grid.clear();
+    floor.reset();
 }
 
-std::vector<std::shared_ptr<Room>> DungeonGenerator::GenerateFloor(const DungeonGenerationParams& params) {
+std::shared_ptr<DungeonFloor> DungeonGenerator::GenerateFloor(const DungeonGenerationParams& params) {
     // Clear any existing dungeon data
     Clear();
     
-    std::cout << "Generating dungeon floor with parameters:" << std::endl;
-    std::cout << "  - Width: " << params.width << std::endl;
-    std::cout << "  - Height: " << params.height << std::endl;
-    std::cout << "  - Number of rooms: " << params.numRooms << std::endl;
-    std::cout << "  - Treasure rooms: " << params.numTreasureRooms << std::endl;
-    std::cout << "  - Boss room: " << (params.hasBossRoom ? "Yes" : "No") << std::endl;
-    std::cout << "  - Difficulty: " << params.difficulty << std::endl;
-    std::cout << "  - Loop chance: " << params.loopChance << std::endl;
+    // Resolve the floor seed and split it into one stream per step
+    uint64_t seed = params.seed != 0 ? params.seed : DungeonSeed::RandomSeed();
+    const uint64_t layoutSeed = DungeonSeed::Derive(seed, SeedStream::LAYOUT);
+    loopRng = DungeonSeed::MakeEngine(DungeonSeed::Derive(seed, SeedStream::LOOPS));
+    treasureRng = DungeonSeed::MakeEngine(DungeonSeed::Derive(seed, SeedStream::TREASURE_PLACEMENT));
+    descriptionRng = DungeonSeed::MakeEngine(DungeonSeed::Derive(seed, SeedStream::DESCRIPTIONS));
+    
+    if (verbose) {
+        std::cout << "Generating dungeon floor with parameters:" << std::endl;
+        std::cout << "  - Width: " << params.width << std::endl;
+        std::cout << "  - Height: " << params.height << std::endl;
+        std::cout << "  - Number of rooms: " << params.numRooms << std::endl;
+        std::cout << "  - Treasure rooms: " << params.numTreasureRooms << std::endl;
+        std::cout << "  - Boss room: " << (params.hasBossRoom ? "Yes" : "No") << std::endl;
+        std::cout << "  - Difficulty: " << params.difficulty << std::endl;
+        std::cout << "  - Loop chance: " << params.loopChance << std::endl;
+        std::cout << "  - Layout: " << (params.layout == LayoutAlgorithm::WAVE_FUNCTION_COLLAPSE
+                                            ? "Wave function collapse" : "Random walk") << std::endl;
+        std::cout << "  - Seed: " << seed << std::endl;
+    }
     
     // Initialize the grid
-    InitializeGrid(params.width, params.height);
+    auto result = std::make_shared<DungeonFloor>(params.width, params.height);
+    DungeonFloor& target = *result;
+    target.SetSeed(seed);
     
     // Calculate number of rooms to generate
     int numRooms = params.numRooms;
@@ -58,21 +85,109 @@ std::vector<std::shared_ptr<Room>> DungeonGenerator::GenerateFloor(const Dungeon
     
     // Ensure we meet minimum requirements
     if (numRooms < 5) numRooms = 5; // Need at least entrance, exit, and a few normal rooms
+    target.ReserveRooms(std::min(numRooms, maxPossibleRooms));
     
     // Step 1: Place the entrance room
     int entranceX = 0;
     int entranceY = params.height / 2;
-    entranceRoom = CreateRoom(0, RoomType::ENTRANCE, entranceX, entranceY);
-    PlaceRoomAt(entranceX, entranceY, entranceRoom);
-    rooms.push_back(entranceRoom);
+    int entranceIndex = CreateRoom(target, RoomType::ENTRANCE, entranceX, entranceY);
+    if (entranceIndex == DungeonFloor::NO_ROOM) {
+        std::cerr << "ERROR: Dungeon grid is too small to place an entrance!" << std::endl;
+        return result;
+    }
+    
+    // Step 2: Lay out the remaining rooms between entrance and exit
+    if (params.layout == LayoutAlgorithm::WAVE_FUNCTION_COLLAPSE) {
+        PlaceCollapseLayout(target, params, numRooms, entranceIndex, layoutSeed);
+    } else {
+        layoutRng = DungeonSeed::MakeEngine(layoutSeed);
+        PlaceWalkLayout(target, params, numRooms, entranceIndex);
+    }
+    
+    // If we didn't place an exit room yet, make sure to place one
+    if (target.GetExitIndex() == DungeonFloor::NO_ROOM) {
+        // Find the farthest room from the entrance to make it the exit
+        int maxDistance = 0;
+        int farthestRoom = DungeonFloor::NO_ROOM;
+        
+        for (const Room& room : target.GetRooms()) {
+            int distance = std::abs(room.GetPositionX() - entranceX) + std::abs(room.GetPositionY() - entranceY);
+            if (distance > maxDistance && room.GetType() == RoomType::NORMAL) {
+                maxDistance = distance;
+                farthestRoom = room.GetId();
+            }
+        }
+        
+        // Convert the farthest room to an exit
+        if (farthestRoom != DungeonFloor::NO_ROOM) {
+            ConvertRoom(target, farthestRoom, RoomType::EXIT);
+        }
+    }
+    
+    // If boss rooms are enabled but we didn't place one, convert a room near the exit
+    if (params.hasBossRoom && target.GetBossIndex() == DungeonFloor::NO_ROOM &&
+        target.GetExitIndex() != DungeonFloor::NO_ROOM) {
+        // Find a room adjacent to the exit
+        const Room& exitRoom = target.GetRoom(target.GetExitIndex());
+        
+        for (int dir = 0; dir < 4; dir++) {
+            int adjIndex = target.GetRoomAt(exitRoom.GetPositionX() + DIR_X[dir],
+                                            exitRoom.GetPositionY() + DIR_Y[dir]);
+            
+            if (adjIndex != DungeonFloor::NO_ROOM && target.GetRoom(adjIndex).GetType() == RoomType::NORMAL) {
+                // Convert to boss room
+                ConvertRoom(target, adjIndex, RoomType::BOSS);
+                break;
+            }
+        }
+    }
+    
+    // Step 3: Add additional connections to create loops
+    CreateRandomLoops(target, params.loopChance);
+    
+    // Step 4: Convert some normal rooms to treasure rooms
+    int treasureRoomsToCreate = std::min(params.numTreasureRooms, 
+                                       target.GetRoomCount() - 3); // -3 for entrance, exit, and boss
+    
+    std::vector<int> normalRoomIndices;
+    for (const Room& room : target.GetRooms()) {
+        if (room.GetType() == RoomType::NORMAL) {
+            normalRoomIndices.push_back(room.GetId());
+        }
+    }
+    
+    // Partial Fisher-Yates: only the rooms that get converted are drawn
+    int candidates = static_cast<int>(normalRoomIndices.size());
+    for (int i = 0; i < treasureRoomsToCreate && i < candidates; i++) {
+        std::uniform_int_distribution<int> pick(i, candidates - 1);
+        std::swap(normalRoomIndices[i], normalRoomIndices[pick(treasureRng)]);
+        
+        // Convert normal rooms to treasure rooms
+        ConvertRoom(target, normalRoomIndices[i], RoomType::TREASURE);
+    }
+    
+    // Step 5: Validate the dungeon to ensure it's playable
+    ValidateDungeon(target);
     
-    // Step 2: Generate a path from entrance to exit using a random walk
-    std::stack<std::pair<int, int>> path;
-    path.push(std::make_pair(entranceX, entranceY));
+    // Step 6: Assign encounters to rooms based on difficulty and walking
+    // distance, which only settles once validation has added its fixes
+    AssignEncounters(target, params.difficulty, seed);
     
-    // Current position
-    int currentX = entranceX;
-    int currentY = entranceY;
+    floor = result;
+    
+    if (verbose) {
+        std::cout << "Dungeon generation complete! Generated " << target.GetRoomCount() << " rooms." << std::endl;
+    }
+    return result;
+}
+
+void DungeonGenerator::PlaceWalkLayout(DungeonFloor& target, const DungeonGenerationParams& params,
+                                       int numRooms, int entranceIndex) {
+    // Random walk from the entrance; the path stack holds room indices and
+    // positions come from the room table
+    std::vector<int> path;
+    path.reserve(numRooms);
+    path.push_back(entranceIndex);
     
     // Target position for exit (far side of map)
     int exitX = params.width - 1;
@@ -85,369 +200,274 @@ std::vector<std::shared_ptr<Room>> DungeonGenerator::GenerateFloor(const Dungeon
     // Track placed rooms (excluding entrance which is already placed)
     int placedRooms = 1;
     
+    std::uniform_int_distribution<int> orderDist(0, 23);
+    
     // Generate main path with random walk
     while (placedRooms < numRooms && !path.empty()) {
         // Get current position
-        currentX = path.top().first;
-        currentY = path.top().second;
+        int currentIndex = path.back();
+        int currentX = target.GetRoom(currentIndex).GetPositionX();
+        int currentY = target.GetRoom(currentIndex).GetPositionY();
         
-        // Possible directions (right, down, left, up)
-        std::vector<std::pair<int, int>> directions = {
-            {1, 0}, {0, 1}, {-1, 0}, {0, -1}
-        };
-        
-        // Shuffle directions for randomness
-        std::shuffle(directions.begin(), directions.end(), rng);
+        // Pick a random direction order
+        const uint8_t* order = DIRECTION_ORDERS[orderDist(layoutRng)];
         
         bool movedToNewRoom = false;
         
         // Try each direction
-        for (const auto& dir : directions) {
-            int newX = currentX + dir.first;
-            int newY = currentY + dir.second;
+        for (int i = 0; i < 4; i++) {
+            int dir = order[i];
+            int newX = currentX + DIR_X[dir];
+            int newY = currentY + DIR_Y[dir];
             
-            // Check if valid position
-            if (newX >= 0 && newX < params.width && newY >= 0 && newY < params.height) {
-                // Check if position is empty
-                if (!grid[newY][newX]) {
-                    // Determine room type
-                    RoomType roomType = RoomType::NORMAL;
-                    
-                    // Check if we're at the exit position
-                    if (newX == exitX && newY == exitY) {
-                        roomType = RoomType::EXIT;
-                    } 
-                    // Check if we're at the boss position and boss rooms are enabled
-                    else if (params.hasBossRoom && newX == bossX && newY == bossY) {
-                        roomType = RoomType::BOSS;
-                    }
-                    
-                    // Create and place the room
-                    auto room = CreateRoom(rooms.size(), roomType, newX, newY);
-                    PlaceRoomAt(newX, newY, room);
-                    rooms.push_back(room);
-                    
-                    // Connect to the previous room
-                    ConnectRooms(grid[currentY][currentX], room);
-                    
-                    // Update special room pointers
-                    if (roomType == RoomType::EXIT) {
-                        exitRoom = room;
-                    } else if (roomType == RoomType::BOSS) {
-                        bossRoom = room;
-                    }
-                    
-                    // Push new position onto the path
-                    path.push(std::make_pair(newX, newY));
-                    
-                    // Update counters
-                    placedRooms++;
-                    movedToNewRoom = true;
-                    break;
-                }
+            // Check if the position is inside the grid and empty
+            if (!target.InBounds(newX, newY) || target.GetRoomAt(newX, newY) != DungeonFloor::NO_ROOM) {
+                continue;
+            }
+            
+            // Determine room type
+            RoomType roomType = RoomType::NORMAL;
+            
+            // Check if we're at the exit position
+            if (newX == exitX && newY == exitY) {
+                roomType = RoomType::EXIT;
+            } 
+            // Check if we're at the boss position and boss rooms are enabled
+            else if (params.hasBossRoom && newX == bossX && newY == bossY) {
+                roomType = RoomType::BOSS;
             }
+            
+            // Create and place the room, then connect it to the previous one
+            int newIndex = CreateRoom(target, roomType, newX, newY);
+            target.Connect(currentIndex, newIndex);
+            
+            // Push new position onto the path
+            path.push_back(newIndex);
+            
+            // Update counters
+            placedRooms++;
+            movedToNewRoom = true;
+            break;
         }
         
         // If we couldn't move to a new room, backtrack
         if (!movedToNewRoom) {
-            path.pop();
+            path.pop_back();
         }
-        
-        // If we've placed enough rooms, stop
-        if (placedRooms >= numRooms) {
+    }
+}
+
+void DungeonGenerator::PlaceCollapseLayout(DungeonFloor& target, const DungeonGenerationParams& params,
+                                           int numRooms, int entranceIndex, uint64_t layoutSeed) {
+    const int width = params.width;
+    const int height = params.height;
+    const int cellCount = width * height;
+    const Room& entrance = target.GetRoom(entranceIndex);
+    const int entranceCell = entrance.GetPositionY() * width + entrance.GetPositionX();
+    
+    // Collapse door tiles outward from the entrance. A collapse that seals
+    // itself off early is retried, continuing the same random stream; the
+    // last attempt is used regardless.
+    uint64_t rngState = layoutSeed;
+    for (int attempt = 1; attempt <= MAX_COLLAPSE_ATTEMPTS; attempt++) {
+        if (collapseSolver.Solve(width, height, {entranceCell}, numRooms, rngState)) {
             break;
         }
     }
-    
-    // If we didn't place an exit room yet, make sure to place one
-    if (!exitRoom) {
-        // Find the farthest room from the entrance to make it the exit
-        int maxDistance = 0;
-        std::shared_ptr<Room> farthestRoom = nullptr;
-        
-        for (int y = 0; y < params.height; y++) {
-            for (int x = 0; x < params.width; x++) {
-                if (grid[y][x]) {
-                    int distance = std::abs(x - entranceX) + std::abs(y - entranceY);
-                    if (distance > maxDistance && grid[y][x]->GetType() == RoomType::NORMAL) {
-                        maxDistance = distance;
-                        farthestRoom = grid[y][x];
-                    }
-                }
+    const std::vector<uint8_t>& doors = collapseSolver.GetTiles();
+    
+    // Breadth-first order from the entrance along the doors. Only the first
+    // numRooms rooms are kept; a prefix of the order is always connected.
+    std::vector<int>& order = collapseOrder;
+    std::vector<int>& parents = collapseParents;
+    order.clear();
+    order.reserve(std::min(cellCount, numRooms * 2));
+    parents.assign(cellCount, -1);
+    parents[entranceCell] = entranceCell;
+    order.push_back(entranceCell);
+    
+    for (size_t i = 0; i < order.size() && static_cast<int>(order.size()) < numRooms; i++) {
+        int cell = order[i];
+        for (int dir = 0; dir < 4; dir++) {
+            // Doors never point past the grid edge, so no bounds check
+            int next = cell + DIR_X[dir] + DIR_Y[dir] * width;
+            if ((doors[cell] & (1 << dir)) && parents[next] < 0 && static_cast<int>(order.size()) < numRooms) {
+                parents[next] = cell;
+                order.push_back(next);
             }
         }
-        
-        // Convert the farthest room to an exit
-        if (farthestRoom) {
-            farthestRoom = CreateRoom(farthestRoom->GetId(), RoomType::EXIT, 
-                                     farthestRoom->GetPositionX(), farthestRoom->GetPositionY());
-            PlaceRoomAt(farthestRoom->GetPositionX(), farthestRoom->GetPositionY(), farthestRoom);
-            
-            // Update the rooms vector
-            for (size_t i = 0; i < rooms.size(); i++) {
-                if (rooms[i]->GetId() == farthestRoom->GetId()) {
-                    rooms[i] = farthestRoom;
-                    break;
-                }
-            }
-            
-            exitRoom = farthestRoom;
-        }
     }
     
-    // If boss rooms are enabled but we didn't place one, convert a room near the exit
-    if (params.hasBossRoom && !bossRoom && exitRoom) {
-        // Find a room adjacent to the exit
-        int exitX = exitRoom->GetPositionX();
-        int exitY = exitRoom->GetPositionY();
-        
-        std::vector<std::pair<int, int>> directions = {
-            {1, 0}, {0, 1}, {-1, 0}, {0, -1}
-        };
-        
-        for (const auto& dir : directions) {
-            int adjX = exitX + dir.first;
-            int adjY = exitY + dir.second;
-            
-            if (adjX >= 0 && adjX < params.width && adjY >= 0 && adjY < params.height) {
-                if (grid[adjY][adjX] && grid[adjY][adjX]->GetType() == RoomType::NORMAL) {
-                    // Convert to boss room
-                    auto oldRoom = grid[adjY][adjX];
-                    auto bossRoom = CreateRoom(oldRoom->GetId(), RoomType::BOSS, adjX, adjY);
-                    PlaceRoomAt(adjX, adjY, bossRoom);
-                    
-                    // Update the rooms vector
-                    for (size_t i = 0; i < rooms.size(); i++) {
-                        if (rooms[i]->GetId() == oldRoom->GetId()) {
-                            rooms[i] = bossRoom;
-                            break;
-                        }
-                    }
-                    
-                    this->bossRoom = bossRoom;
-                    break;
-                }
-            }
-        }
+    // The last room in the order is the farthest walk from the entrance:
+    // it becomes the exit, guarded by the room before it
+    int exitCell = order.size() > 1 ? order.back() : -1;
+    int bossCell = exitCell >= 0 ? parents[exitCell] : -1;
+    if (!params.hasBossRoom || bossCell == entranceCell) {
+        bossCell = -1;
     }
     
-    // Step 3: Add additional connections to create loops
-    CreateRandomLoops(params.loopChance);
-    
-    // Step 4: Convert some normal rooms to treasure rooms
-    int treasureRoomsToCreate = std::min(params.numTreasureRooms, 
-                                       static_cast<int>(rooms.size() - 3)); // -3 for entrance, exit, and boss
-    
-    std::vector<int> normalRoomIndices;
-    for (size_t i = 0; i < rooms.size(); i++) {
-        if (rooms[i]->GetType() == RoomType::NORMAL) {
-            normalRoomIndices.push_back(i);
+    for (size_t i = 1; i < order.size(); i++) {
+        int cell = order[i];
+        RoomType roomType = RoomType::NORMAL;
+        if (cell == exitCell) {
+            roomType = RoomType::EXIT;
+        } else if (cell == bossCell) {
+            roomType = RoomType::BOSS;
         }
+        CreateRoom(target, roomType, cell % width, cell / width);
     }
     
-    // Shuffle to randomize selection
-    std::shuffle(normalRoomIndices.begin(), normalRoomIndices.end(), rng);
-    
-    // Convert normal rooms to treasure rooms
-    for (int i = 0; i < treasureRoomsToCreate && i < static_cast<int>(normalRoomIndices.size()); i++) {
-        int roomIndex = normalRoomIndices[i];
-        auto oldRoom = rooms[roomIndex];
-        int x = oldRoom->GetPositionX();
-        int y = oldRoom->GetPositionY();
-        
-        auto treasureRoom = CreateRoom(oldRoom->GetId(), RoomType::TREASURE, x, y);
-        PlaceRoomAt(x, y, treasureRoom);
-        rooms[roomIndex] = treasureRoom;
+    // Connect the kept rooms through their doors; right and down cover
+    // each pair once
+    const std::vector<int>& cells = target.GetCells();
+    for (int cell : order) {
+        for (int dir = 0; dir < 2; dir++) {
+            int next = cell + DIR_X[dir] + DIR_Y[dir] * width;
+            if ((doors[cell] & (1 << dir)) && cells[next] != DungeonFloor::NO_ROOM) {
+                target.Connect(cells[cell], cells[next]);
+            }
+        }
     }
-    
-    // Step 5: Assign encounters to rooms based on difficulty
-    AssignEncounters(params.difficulty);
-    
-    // Step 6: Validate the dungeon to ensure it's playable
-    ValidateDungeon();
-    
-    std::cout << "Dungeon generation complete! Generated " << rooms.size() << " rooms." << std::endl;
-    return rooms;
 }
 
-void DungeonGenerator::InitializeGrid(int width, int height) {
-    grid.clear();
-    grid.resize(height, std::vector<std::shared_ptr<Room>>(width, nullptr));
+int DungeonGenerator::CreateRoom(DungeonFloor& target, RoomType type, int x, int y) {
+    int index = target.AddRoom(type, x, y);
+    if (index != DungeonFloor::NO_ROOM) {
+        DescribeRoom(target.GetRoom(index));
+    }
+    return index;
 }
 
-void DungeonGenerator::PlaceRoomAt(int x, int y, std::shared_ptr<Room> room) {
-    if (x >= 0 && x < static_cast<int>(grid[0].size()) && 
-        y >= 0 && y < static_cast<int>(grid.size())) {
-        grid[y][x] = room;
-        room->SetPosition(x, y);
-    }
+void DungeonGenerator::ConvertRoom(DungeonFloor& target, int index, RoomType type) {
+    // Rooms keep their index, position and connections; only the role changes
+    target.SetRoomType(index, type);
+    DescribeRoom(target.GetRoom(index));
 }
 
-std::shared_ptr<Room> DungeonGenerator::CreateRoom(int id, RoomType type, int x, int y) {
-    auto room = std::make_shared<Room>(id, type);
-    room->SetPosition(x, y);
+void DungeonGenerator::DescribeRoom(Room& room) {
+    // Descriptions are interned once; every room of a type shares its text
+    static const Engine::StringId ENTRANCE_DESCRIPTION = Engine::StringInterner::GetInstance().Intern(
+        "The entrance to the dungeon floor. A cold draft blows from deeper within.");
+    static const Engine::StringId EXIT_DESCRIPTION = Engine::StringInterner::GetInstance().Intern(
+        "A staircase leading to the next floor of the dungeon awaits.");
+    static const Engine::StringId BOSS_DESCRIPTION = Engine::StringInterner::GetInstance().Intern(
+        "An imposing chamber with strange markings. Something powerful lurks here.");
+    static const Engine::StringId TREASURE_DESCRIPTION = Engine::StringInterner::GetInstance().Intern(
+        "A room filled with glittering gold and valuable treasures. What riches await?");
+    static const Engine::StringId NORMAL_DESCRIPTIONS[] = {
+        Engine::StringInterner::GetInstance().Intern("A damp chamber with water dripping from the ceiling."),
+        Engine::StringInterner::GetInstance().Intern("Ancient runes cover the walls of this mysterious room."),
+        Engine::StringInterner::GetInstance().Intern("Cobwebs fill the corners of this neglected area."),
+        Engine::StringInterner::GetInstance().Intern("The remnants of a camp suggest others have passed through recently."),
+        Engine::StringInterner::GetInstance().Intern("Broken furniture and debris litter this once-inhabited room."),
+        Engine::StringInterner::GetInstance().Intern("A standard dungeon chamber with stone walls and flickering torches.")
+    };
     
     // Set custom descriptions based on room type
-    switch (type) {
+    switch (room.GetType()) {
         case RoomType::ENTRANCE:
-            room->SetDescription("The entrance to the dungeon floor. A cold draft blows from deeper within.");
+            room.SetDescription(ENTRANCE_DESCRIPTION);
             break;
         case RoomType::EXIT:
-            room->SetDescription("A staircase leading to the next floor of the dungeon awaits.");
+            room.SetDescription(EXIT_DESCRIPTION);
             break;
         case RoomType::BOSS:
-            room->SetDescription("An imposing chamber with strange markings. Something powerful lurks here.");
+            room.SetDescription(BOSS_DESCRIPTION);
             break;
         case RoomType::TREASURE:
-            room->SetDescription("A room filled with glittering gold and valuable treasures. What riches await?");
+            room.SetDescription(TREASURE_DESCRIPTION);
             break;
         case RoomType::NORMAL:
             // Random descriptions for normal rooms
             {
                 std::uniform_int_distribution<int> dist(0, 5);
-                int descType = dist(rng);
-                
-                switch (descType) {
-                    case 0:
-                        room->SetDescription("A damp chamber with water dripping from the ceiling.");
-                        break;
-                    case 1:
-                        room->SetDescription("Ancient runes cover the walls of this mysterious room.");
-                        break;
-                    case 2:
-                        room->SetDescription("Cobwebs fill the corners of this neglected area.");
-                        break;
-                    case 3:
-                        room->SetDescription("The remnants of a camp suggest others have passed through recently.");
-                        break;
-                    case 4:
-                        room->SetDescription("Broken furniture and debris litter this once-inhabited room.");
-                        break;
-                    default:
-                        room->SetDescription("A standard dungeon chamber with stone walls and flickering torches.");
-                        break;
-                }
+                room.SetDescription(NORMAL_DESCRIPTIONS[dist(descriptionRng)]);
             }
             break;
     }
-    
-    return room;
-}
-
-void DungeonGenerator::ConnectRooms(std::shared_ptr<Room> room1, std::shared_ptr<Room> room2) {
-    if (room1 && room2) {
-        room1->AddConnection(room2);
-    }
 }
 
-bool DungeonGenerator::TryConnectAdjacentRooms(int x, int y) {
-    if (x < 0 || y < 0 || x >= static_cast<int>(grid[0].size()) || y >= static_cast<int>(grid.size())) {
-        return false;
-    }
-    
-    if (!grid[y][x]) {
+bool DungeonGenerator::TryConnectAdjacentRooms(DungeonFloor& target, int x, int y) {
+    int index = target.GetRoomAt(x, y);
+    if (index == DungeonFloor::NO_ROOM) {
         return false;
     }
     
     bool madeConnection = false;
     
-    // Possible directions (right, down, left, up)
-    std::vector<std::pair<int, int>> directions = {
-        {1, 0}, {0, 1}, {-1, 0}, {0, -1}
-    };
-    
-    // Try to connect to each adjacent room
-    for (const auto& dir : directions) {
-        int adjX = x + dir.first;
-        int adjY = y + dir.second;
-        
-        if (adjX >= 0 && adjX < static_cast<int>(grid[0].size()) && 
-            adjY >= 0 && adjY < static_cast<int>(grid.size())) {
-            
-            if (grid[adjY][adjX]) {
-                // Connect if not already connected
-                if (!grid[y][x]->IsConnectedTo(grid[adjY][adjX]->GetId())) {
-                    ConnectRooms(grid[y][x], grid[adjY][adjX]);
-                    madeConnection = true;
-                }
-            }
+    // Try to connect to each adjacent room (Connect ignores existing edges)
+    for (int dir = 0; dir < 4; dir++) {
+        int adjIndex = target.GetRoomAt(x + DIR_X[dir], y + DIR_Y[dir]);
+        if (adjIndex != DungeonFloor::NO_ROOM && target.Connect(index, adjIndex)) {
+            madeConnection = true;
         }
     }
     
     return madeConnection;
 }
 
-void DungeonGenerator::CreateRandomLoops(float loopChance) {
+void DungeonGenerator::CreateRandomLoops(DungeonFloor& target, float loopChance) {
     // Only create loops if the chance is positive
     if (loopChance <= 0.0f) {
         return;
     }
     
-    int width = grid[0].size();
-    int height = grid.size();
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    const std::vector<int>& cells = target.GetCells();
     
     // Try to connect adjacent rooms that aren't already connected
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            if (grid[y][x]) {
-                // For each room, consider connecting to adjacent rooms
-                std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-                if (dist(rng) < loopChance) {
-                    TryConnectAdjacentRooms(x, y);
-                }
-            }
+    for (int cell = 0; cell < static_cast<int>(cells.size()); cell++) {
+        if (cells[cell] != DungeonFloor::NO_ROOM && dist(loopRng) < loopChance) {
+            TryConnectAdjacentRooms(target, cell % target.GetWidth(), cell / target.GetWidth());
         }
     }
 }
 
-void DungeonGenerator::AssignEncounters(int difficulty) {
-    // Assign encounters to each room based on type
-    for (auto& room : rooms) {
-        switch (room->GetType()) {
+void DungeonGenerator::AssignEncounters(DungeonFloor& target, int difficulty, uint64_t seed) {
+    // Scale by walking distance from the entrance, so loops that bring a
+    // room closer also make it easier
+    const DistanceField& field = target.GetDistanceField();
+    int farthest = std::max(field.GetFarthest(DistanceLane::ENTRANCE), 1);
+    
+    // Rooms only record what they will contain; the encounter objects are
+    // built when the player first enters (see Room::Enter)
+    for (Room& room : target.GetRooms()) {
+        EncounterDescriptor descriptor;
+        
+        switch (room.GetType()) {
             case RoomType::NORMAL: {
-                // Create combat encounter with difficulty proportional to distance from entrance
-                int distFromEntrance = std::abs(room->GetPositionX() - entranceRoom->GetPositionX()) + 
-                                    std::abs(room->GetPositionY() - entranceRoom->GetPositionY());
+                // Combat encounter with difficulty proportional to distance from entrance
+                int distFromEntrance = field.GetDistance(DistanceLane::ENTRANCE, room.GetId());
+                if (distFromEntrance == DistanceField::UNREACHABLE) {
+                    distFromEntrance = farthest;
+                }
                 
                 // Scale encounter difficulty from 1 to difficulty+2
-                int encounterDifficulty = 1 + (distFromEntrance * difficulty) / 
-                                        (grid.size() + grid[0].size());
+                int encounterDifficulty = 1 + (distFromEntrance * difficulty) / farthest;
                 
                 // Cap difficulty
                 encounterDifficulty = std::min(encounterDifficulty, difficulty + 2);
                 
-                // Create a unique name for the encounter
-                std::stringstream ss;
-                ss << "Combat Encounter " << room->GetId();
-                
-                auto encounter = std::make_shared<CombatEncounter>(ss.str(), encounterDifficulty);
-                room->SetEncounter(encounter);
+                descriptor.type = EncounterType::COMBAT;
+                descriptor.level = encounterDifficulty;
+                descriptor.seed = DungeonSeed::Derive(seed, SeedStream::ENCOUNTERS, room.GetId());
                 break;
             }
             
             case RoomType::TREASURE: {
-                // Create treasure encounter with quality proportional to difficulty
-                int quality = 1 + difficulty / 2;
-                
-                // Create a unique name for the encounter
-                std::stringstream ss;
-                ss << "Treasure Chest " << room->GetId();
-                
-                auto encounter = std::make_shared<TreasureEncounter>(ss.str(), quality);
-                room->SetEncounter(encounter);
+                // Treasure encounter with quality proportional to difficulty
+                descriptor.type = EncounterType::TREASURE;
+                descriptor.level = 1 + difficulty / 2;
+                descriptor.seed = DungeonSeed::Derive(seed, SeedStream::LOOT, room.GetId());
                 break;
             }
             
             case RoomType::BOSS: {
-                // Create high-difficulty combat encounter
-                int bossDifficulty = difficulty + 3;
-                
-                // Create a unique name for the encounter
-                std::stringstream ss;
-                ss << "Boss Encounter " << room->GetId();
-                
-                auto encounter = std::make_shared<CombatEncounter>(ss.str(), bossDifficulty);
-                room->SetEncounter(encounter);
+                // High-difficulty combat encounter
+                descriptor.type = EncounterType::COMBAT;
+                descriptor.boss = true;
+                descriptor.level = difficulty + 3;
+                descriptor.seed = DungeonSeed::Derive(seed, SeedStream::ENCOUNTERS, room.GetId());
                 break;
             }
             
@@ -455,104 +475,74 @@ void DungeonGenerator::AssignEncounters(int difficulty) {
             default:
                 break;
         }
+        
+        room.SetEncounterDescriptor(descriptor);
     }
 }
 
-void DungeonGenerator::ValidateDungeon() {
+void DungeonGenerator::ValidateDungeon(DungeonFloor& target) {
+    int entranceIndex = target.GetEntranceIndex();
+    int exitIndex = target.GetExitIndex();
+    
     // Check if we have an entrance and exit
-    if (!entranceRoom) {
+    if (entranceIndex == DungeonFloor::NO_ROOM) {
         std::cerr << "ERROR: Dungeon has no entrance room!" << std::endl;
     }
     
-    if (!exitRoom) {
+    if (exitIndex == DungeonFloor::NO_ROOM) {
         std::cerr << "ERROR: Dungeon has no exit room!" << std::endl;
     }
     
-    // Verify connectivity using BFS
-    if (entranceRoom && exitRoom) {
-        // Set all rooms as unvisited
-        std::unordered_map<int, bool> visited;
-        for (const auto& room : rooms) {
-            visited[room->GetId()] = false;
-        }
+    if (entranceIndex == DungeonFloor::NO_ROOM || exitIndex == DungeonFloor::NO_ROOM) {
+        return;
+    }
+    
+    // Verify connectivity with the floor's distance field; fixes below
+    // update it incrementally instead of flooding the floor again
+    const DistanceField& field = target.GetDistanceField();
+    
+    // Check if exit is reachable
+    if (!field.IsReachable(DistanceLane::ENTRANCE, exitIndex)) {
+        std::cerr << "ERROR: Exit is not reachable from entrance!" << std::endl;
         
-        // BFS from entrance
-        std::queue<std::shared_ptr<Room>> queue;
-        queue.push(entranceRoom);
-        visited[entranceRoom->GetId()] = true;
+        // Find closest room to exit that is reachable
+        const Room& exitRoom = target.GetRoom(exitIndex);
+        int closestRoom = DungeonFloor::NO_ROOM;
+        int minDistance = std::numeric_limits<int>::max();
         
-        while (!queue.empty()) {
-            auto current = queue.front();
-            queue.pop();
-            
-            for (const auto& neighbor : current->GetConnections()) {
-                if (!visited[neighbor->GetId()]) {
-                    visited[neighbor->GetId()] = true;
-                    queue.push(neighbor);
+        for (const Room& room : target.GetRooms()) {
+            if (field.IsReachable(DistanceLane::ENTRANCE, room.GetId())) {
+                int distance = std::abs(room.GetPositionX() - exitRoom.GetPositionX()) + 
+                            std::abs(room.GetPositionY() - exitRoom.GetPositionY());
+                
+                if (distance < minDistance) {
+                    minDistance = distance;
+                    closestRoom = room.GetId();
                 }
             }
         }
         
-        // Check if exit is reachable
-        if (!visited[exitRoom->GetId()]) {
-            std::cerr << "ERROR: Exit is not reachable from entrance!" << std::endl;
-            
-            // Find closest room to exit that is reachable
-            std::shared_ptr<Room> closestRoom = nullptr;
-            int minDistance = std::numeric_limits<int>::max();
-            
-            for (const auto& room : rooms) {
-                if (visited[room->GetId()]) {
-                    int distance = std::abs(room->GetPositionX() - exitRoom->GetPositionX()) + 
-                                std::abs(room->GetPositionY() - exitRoom->GetPositionY());
-                    
-                    if (distance < minDistance) {
-                        minDistance = distance;
-                        closestRoom = room;
-                    }
-                }
-            }
-            
-            // Connect closest reachable room to exit
-            if (closestRoom) {
-                std::cout << "Fixing dungeon: Connecting room " << closestRoom->GetId() 
-                         << " to exit (room " << exitRoom->GetId() << ")" << std::endl;
-                ConnectRooms(closestRoom, exitRoom);
+        // Connect closest reachable room to exit
+        if (closestRoom != DungeonFloor::NO_ROOM) {
+            if (verbose) {
+                std::cout << "Fixing dungeon: Connecting room " << closestRoom 
+                         << " to exit (room " << exitIndex << ")" << std::endl;
             }
+            target.Connect(closestRoom, exitIndex);
         }
-        
-        // Check if any rooms are unreachable
-        for (const auto& room : rooms) {
-            if (!visited[room->GetId()]) {
-                std::cout << "Warning: Room " << room->GetId() << " is not reachable from entrance." << std::endl;
-            }
+    }
+    
+    // Check if any rooms are unreachable
+    int reachedRooms = field.GetReachedCount(DistanceLane::ENTRANCE);
+    for (int i = 0; reachedRooms < target.GetRoomCount() && i < target.GetRoomCount(); i++) {
+        if (!field.IsReachable(DistanceLane::ENTRANCE, i) && verbose) {
+            std::cout << "Warning: Room " << i << " is not reachable from entrance." << std::endl;
         }
     }
 }
 
-std::shared_ptr<Room> DungeonGenerator::GetEntranceRoom() const {
-    return entranceRoom;
-}
-
-std::shared_ptr<Room> DungeonGenerator::GetExitRoom() const {
-    return exitRoom;
-}
-
-const std::vector<std::shared_ptr<Room>>& DungeonGenerator::GetAllRooms() const {
-    return rooms;
-}
-
-std::shared_ptr<Room> DungeonGenerator::GetRoom(int id) const {
-    auto it = std::find_if(rooms.begin(), rooms.end(),
-                         [id](const std::shared_ptr<Room>& room) {
-                             return room->GetId() == id;
-                         });
-    
-    if (it != rooms.end()) {
-        return *it;
-    }
-    
-    return nullptr;
+std::shared_ptr<DungeonFloor> DungeonGenerator::GetCurrentFloor() const {
+    return floor;
 }
 
 } // namespace Game 
\ No newline at end of file
@@ -1,14 +1,22 @@
 #pragma once
 
-#include "Room.h"
+#include "DungeonFloor.h"
+#include "DungeonSeed.h"
+#include "WaveFunctionCollapse.h"
 #include <memory>
 #include <vector>
 #include <random>
-#include <unordered_map>
-#include <functional>
 
 namespace Game {
 
+/**
+ * How the rooms of a floor are laid out
+ */
+enum class LayoutAlgorithm {
+    RANDOM_WALK,            // Backtracking walk from the entrance towards the exit
+    WAVE_FUNCTION_COLLAPSE  // Door tiles collapsed outward from the entrance
+};
+
 /**
  * Parameters for dungeon generation
  */
@@ -22,6 +30,8 @@ struct DungeonGenerationParams {
     bool hasBossRoom = true;     // Whether to include a boss room
     int difficulty = 1;          // Overall difficulty level
     float loopChance = 0.2f;     // Chance to create loops in the dungeon (0.0 - 1.0)
+    uint64_t seed = 0;           // Drives every random choice; 0 picks a fresh seed
+    LayoutAlgorithm layout = LayoutAlgorithm::RANDOM_WALK;
     
     // Constructor with defaults
     DungeonGenerationParams() = default;
@@ -45,57 +55,60 @@ struct DungeonGenerationParams {
 };
 
 /**
- * Manages procedural generation of dungeon floors
+ * Manages procedural generation of dungeon floors.
+ * The shared instance serves interactive callers; background workers create
+ * their own generator so no state is shared across threads.
  */
 class DungeonGenerator {
 public:
-    // Get singleton instance
+    DungeonGenerator();
+    
+    // Get shared instance
     static DungeonGenerator& GetInstance();
     
+    // Progress logging to stdout (errors are always reported)
+    void SetVerbose(bool enabled) { verbose = enabled; }
+    bool IsVerbose() const { return verbose; }
+    
     // Generate a new dungeon floor
-    std::vector<std::shared_ptr<Room>> GenerateFloor(const DungeonGenerationParams& params = DungeonGenerationParams());
+    std::shared_ptr<DungeonFloor> GenerateFloor(const DungeonGenerationParams& params = DungeonGenerationParams());
     
     // Clear all dungeon data
     void Clear();
     
-    // Get the entrance room
-    std::shared_ptr<Room> GetEntranceRoom() const;
-    
-    // Get the exit room
-    std::shared_ptr<Room> GetExitRoom() const;
-    
-    // Get all rooms
-    const std::vector<std::shared_ptr<Room>>& GetAllRooms() const;
-    
-    // Get specific room by ID
-    std::shared_ptr<Room> GetRoom(int id) const;
+    // Get the most recently generated floor
+    std::shared_ptr<DungeonFloor> GetCurrentFloor() const;
     
 private:
-    // Private constructor for singleton
-    DungeonGenerator();
+    bool verbose;
     
-    // Random engine
-    std::mt19937 rng;
+    // Random engines, one per generation step, reseeded from the floor seed.
+    // Only the walk uses layoutRng; the collapse draws from the layout
+    // stream's SplitMix64 state instead.
+    std::mt19937 layoutRng;
+    std::mt19937 loopRng;
+    std::mt19937 treasureRng;
+    std::mt19937 descriptionRng;
     
-    // Current dungeon state
-    std::vector<std::shared_ptr<Room>> rooms;
-    std::shared_ptr<Room> entranceRoom;
-    std::shared_ptr<Room> exitRoom;
-    std::shared_ptr<Room> bossRoom;
+    // Wave function collapse layout; kept between floors so buffers are reused
+    WaveFunctionCollapse collapseSolver;
+    std::vector<int> collapseOrder;
+    std::vector<int> collapseParents;
     
-    // Map for room placement grid
-    using RoomGrid = std::vector<std::vector<std::shared_ptr<Room>>>;
-    RoomGrid grid;
+    // Current dungeon state
+    std::shared_ptr<DungeonFloor> floor;
     
     // Helper methods
-    void InitializeGrid(int width, int height);
-    void PlaceRoomAt(int x, int y, std::shared_ptr<Room> room);
-    std::shared_ptr<Room> CreateRoom(int id, RoomType type, int x, int y);
-    void ConnectRooms(std::shared_ptr<Room> room1, std::shared_ptr<Room> room2);
-    bool TryConnectAdjacentRooms(int x, int y);
-    void CreateRandomLoops(float loopChance);
-    void AssignEncounters(int difficulty);
-    void ValidateDungeon();
+    void PlaceWalkLayout(DungeonFloor& target, const DungeonGenerationParams& params, int numRooms, int entranceIndex);
+    void PlaceCollapseLayout(DungeonFloor& target, const DungeonGenerationParams& params, int numRooms, int entranceIndex,
+                             uint64_t layoutSeed);
+    int CreateRoom(DungeonFloor& target, RoomType type, int x, int y);
+    void ConvertRoom(DungeonFloor& target, int index, RoomType type);
+    void DescribeRoom(Room& room);
+    bool TryConnectAdjacentRooms(DungeonFloor& target, int x, int y);
+    void CreateRandomLoops(DungeonFloor& target, float loopChance);
+    void AssignEncounters(DungeonFloor& target, int difficulty, uint64_t seed);
+    void ValidateDungeon(DungeonFloor& target);
 };
 
 } // namespace Game 
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+
+namespace Game {
+
+/**
+ * Independent random sub-streams derived from a floor seed.
+ * Every generation step draws from its own stream so that changing how many
+ * numbers one step consumes never shifts the results of another.
+ */
+enum class SeedStream : uint64_t {
+    LAYOUT = 1,         // Room placement (random walk or wave function collapse)
+    LOOPS,              // Extra connections between adjacent rooms
+    TREASURE_PLACEMENT, // Which normal rooms become treasure rooms
+    DESCRIPTIONS,       // Flavour text of normal rooms
+    ENCOUNTERS,         // Enemy contents of combat encounters (per room)
+    LOOT,               // Items of treasure encounters (per room)
+    FLOORS,             // Seeds of the following floors in a run (per floor)
+    COMBAT              // Rolls of a combat encounter, derived from its own seed
+};
+
+namespace DungeonSeed {
+
+/**
+ * SplitMix64 step: advances the state and returns a well-mixed 64-bit value
+ */
+inline uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Derive the seed of a sub-stream. The index separates per-room streams.
+ */
+inline uint64_t Derive(uint64_t seed, SeedStream stream, uint64_t index = 0) {
+    uint64_t state = seed;
+    uint64_t mixed = SplitMix64(state) ^ (static_cast<uint64_t>(stream) * 0xD1B54A32D192ED03ULL);
+    state = mixed;
+    mixed = SplitMix64(state) ^ (index * 0x8CB92BA72F3D8DD7ULL);
+    state = mixed;
+    return SplitMix64(state);
+}
+
+/**
+ * Seed of a floor within a run, so a whole descent replays from one seed
+ */
+inline uint64_t ForFloor(uint64_t runSeed, int floorNumber) {
+    uint64_t seed = Derive(runSeed, SeedStream::FLOORS, static_cast<uint64_t>(floorNumber));
+    return seed != 0 ? seed : 1;
+}
+
+/**
+ * Build an engine from a seed. Derived seeds are already well mixed, so
+ * folding them to 32 bits loses nothing that std::seed_seq would restore,
+ * and avoids its cost (several engines are built per floor and per room).
+ */
+inline std::mt19937 MakeEngine(uint64_t seed) {
+    return std::mt19937(static_cast<uint32_t>(seed ^ (seed >> 32)));
+}
+
+/**
+ * A fresh non-deterministic seed (never 0, which means "pick one for me")
+ */
+inline uint64_t RandomSeed() {
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) | device();
+    return seed != 0 ? seed : 1;
+}
+
+} // namespace DungeonSeed
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "FloorCache.h"
+#include "FloorSerializer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+namespace Game {
+
+FloorCache::FloorCache(const std::string& directory, size_t memoryBudget)
+    : directory(directory),
+      memoryBudget(memoryBudget),
+      residentBytes(0),
+      currentFloor(0),
+      evictions(0),
+      pageIns(0) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "Failed to create floor cache directory " << directory << ": " << error.message() << std::endl;
+    }
+}
+
+FloorCache::~FloorCache() {
+    Clear();
+}
+
+void FloorCache::Store(int floorNumber, std::shared_ptr<DungeonFloor> floor) {
+    Entry& entry = entries[floorNumber];
+    if (entry.floor) {
+        residentBytes -= entry.bytes;
+    }
+
+    // The new floor supersedes anything evicted under this number
+    if (entry.onDisk) {
+        std::remove(GetFilePath(floorNumber).c_str());
+        entry.onDisk = false;
+    }
+
+    entry.floor = std::move(floor);
+    entry.bytes = entry.floor ? entry.floor->GetMemoryUsage() : 0;
+    residentBytes += entry.bytes;
+
+    EnforceBudget();
+}
+
+std::shared_ptr<DungeonFloor> FloorCache::Get(int floorNumber) {
+    auto it = entries.find(floorNumber);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+
+    Entry& entry = it->second;
+    if (entry.floor) {
+        return entry.floor;
+    }
+
+    if (!entry.onDisk) {
+        return nullptr;
+    }
+
+    // Page the floor back in; holding the local reference keeps it from
+    // being evicted again by the budget check below
+    std::shared_ptr<DungeonFloor> floor = FloorSerializer::Load(GetFilePath(floorNumber));
+    if (!floor) {
+        std::cerr << "Failed to page in floor " << floorNumber << std::endl;
+        return nullptr;
+    }
+
+    entry.floor = floor;
+    entry.bytes = floor->GetMemoryUsage();
+    residentBytes += entry.bytes;
+    pageIns++;
+
+    EnforceBudget();
+    return floor;
+}
+
+void FloorCache::SetCurrentFloor(int floorNumber) {
+    currentFloor = floorNumber;
+    EnforceBudget();
+}
+
+bool FloorCache::IsResident(int floorNumber) const {
+    auto it = entries.find(floorNumber);
+    return it != entries.end() && it->second.floor != nullptr;
+}
+
+void FloorCache::Clear() {
+    for (const auto& [floorNumber, entry] : entries) {
+        if (entry.onDisk) {
+            std::remove(GetFilePath(floorNumber).c_str());
+        }
+    }
+
+    entries.clear();
+    residentBytes = 0;
+}
+
+void FloorCache::SetMemoryBudget(size_t bytes) {
+    memoryBudget = bytes;
+    EnforceBudget();
+}
+
+int FloorCache::GetResidentCount() const {
+    int count = 0;
+    for (const auto& [floorNumber, entry] : entries) {
+        if (entry.floor) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool FloorCache::IsPinned(int floorNumber) const {
+    return std::abs(floorNumber - currentFloor) <= 1;
+}
+
+bool FloorCache::Evict(int floorNumber, Entry& entry) {
+    // A floor someone else still holds could change after it was written
+    if (entry.floor.use_count() > 1) {
+        return false;
+    }
+
+    if (!FloorSerializer::Save(*entry.floor, GetFilePath(floorNumber))) {
+        return false;
+    }
+
+    residentBytes -= entry.bytes;
+    entry.floor.reset();
+    entry.onDisk = true;
+    evictions++;
+    return true;
+}
+
+void FloorCache::EnforceBudget() {
+    // Floors grow while they are played (distance fields, live encounters),
+    // so refresh their sizes before deciding what to evict
+    residentBytes = 0;
+    std::vector<int> candidates;
+    for (auto& [floorNumber, entry] : entries) {
+        if (!entry.floor) {
+            continue;
+        }
+
+        entry.bytes = entry.floor->GetMemoryUsage();
+        residentBytes += entry.bytes;
+        if (!IsPinned(floorNumber)) {
+            candidates.push_back(floorNumber);
+        }
+    }
+
+    if (residentBytes <= memoryBudget) {
+        return;
+    }
+
+    // Farthest from the player first; on a tie the shallower floor goes
+    std::sort(candidates.begin(), candidates.end(), [this](int a, int b) {
+        int distanceA = std::abs(a - currentFloor);
+        int distanceB = std::abs(b - currentFloor);
+        return distanceA != distanceB ? distanceA > distanceB : a < b;
+    });
+
+    for (int floorNumber : candidates) {
+        if (residentBytes <= memoryBudget) {
+            break;
+        }
+        Evict(floorNumber, entries[floorNumber]);
+    }
+}
+
+std::string FloorCache::GetFilePath(int floorNumber) const {
+    return directory + "/floor_" + std::to_string(floorNumber) + ".bin";
+}
+
+} // namespace Game 
\ No newline at end of file
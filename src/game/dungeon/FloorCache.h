@@ -0,0 +1,81 @@
+#pragma once
+
+#include "DungeonFloor.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <cstddef>
+
+namespace Game {
+
+/**
+ * Keeps the floors of a run within a fixed memory budget.
+ *
+ * The current floor and its neighbours (the floors directly above and
+ * below) are pinned in memory. Other floors stay resident while the
+ * budget allows. Beyond that they are written to disk in the binary floor
+ * format, farthest from the current floor first, and paged back in when
+ * they are requested again.
+ *
+ * The cache is meant for the thread that drives the run; it is not
+ * synchronised.
+ */
+class FloorCache {
+public:
+    FloorCache(const std::string& directory, size_t memoryBudget);
+    ~FloorCache();
+
+    FloorCache(const FloorCache&) = delete;
+    FloorCache& operator=(const FloorCache&) = delete;
+
+    // Add (or replace) a floor; it starts out resident
+    void Store(int floorNumber, std::shared_ptr<DungeonFloor> floor);
+
+    /**
+     * Get a floor, paging it back in from disk if it was evicted.
+     * Returns nullptr for floors the cache has never seen.
+     */
+    std::shared_ptr<DungeonFloor> Get(int floorNumber);
+
+    // Move the pinned window to a floor and evict what no longer fits
+    void SetCurrentFloor(int floorNumber);
+    int GetCurrentFloor() const { return currentFloor; }
+
+    bool Contains(int floorNumber) const { return entries.find(floorNumber) != entries.end(); }
+    bool IsResident(int floorNumber) const;
+
+    // Drop every floor and delete the evicted files
+    void Clear();
+
+    // Budget and statistics
+    size_t GetMemoryBudget() const { return memoryBudget; }
+    void SetMemoryBudget(size_t bytes);
+    size_t GetResidentBytes() const { return residentBytes; }
+    int GetResidentCount() const;
+    int GetFloorCount() const { return static_cast<int>(entries.size()); }
+    int GetEvictionCount() const { return evictions; }
+    int GetPageInCount() const { return pageIns; }
+
+private:
+    struct Entry {
+        std::shared_ptr<DungeonFloor> floor;    // nullptr while evicted
+        size_t bytes = 0;                       // Size when last resident
+        bool onDisk = false;                    // A file for this floor exists
+    };
+
+    bool IsPinned(int floorNumber) const;
+    bool Evict(int floorNumber, Entry& entry);
+    void EnforceBudget();
+    std::string GetFilePath(int floorNumber) const;
+
+    std::string directory;
+    size_t memoryBudget;
+    size_t residentBytes;
+    int currentFloor;
+    int evictions;
+    int pageIns;
+
+    std::map<int, Entry> entries;
+};
+
+} // namespace Game 
\ No newline at end of file
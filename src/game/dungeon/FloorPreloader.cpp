@@ -0,0 +1,145 @@
+#include "FloorPreloader.h"
+#include <chrono>
+
+namespace Game {
+
+FloorPreloader::FloorPreloader(ParamsProvider provider, int lookahead)
+    : provider(std::move(provider)),
+      lookahead(lookahead < 1 ? 1 : lookahead),
+      building(0),
+      generation(0),
+      stopping(false),
+      lastBuildMs(0.0) {
+    // Background generation must not interleave with the main thread's output
+    generator.SetVerbose(false);
+    worker = std::thread(&FloorPreloader::WorkerLoop, this);
+}
+
+FloorPreloader::~FloorPreloader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    floorFinished.notify_all();
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void FloorPreloader::PrepareAfter(int currentFloor) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Floors the player has already reached will never be taken
+    for (auto it = finished.begin(); it != finished.end();) {
+        if (it->first <= currentFloor) {
+            it = finished.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (int floorNumber = currentFloor + 1; floorNumber <= currentFloor + lookahead; ++floorNumber) {
+        if (!IsKnown(floorNumber)) {
+            pending.push_back(Job{floorNumber, provider(floorNumber)});
+        }
+    }
+
+    workAvailable.notify_one();
+}
+
+std::shared_ptr<DungeonFloor> FloorPreloader::TakeFloor(int floorNumber) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        auto it = finished.find(floorNumber);
+        if (it != finished.end()) {
+            std::shared_ptr<DungeonFloor> floor = std::move(it->second);
+            finished.erase(it);
+            return floor;
+        }
+
+        if (stopping) {
+            return nullptr;
+        }
+
+        // Not requested yet (or discarded by Clear): build it next
+        if (!IsKnown(floorNumber)) {
+            pending.push_front(Job{floorNumber, provider(floorNumber)});
+            workAvailable.notify_one();
+        }
+
+        floorFinished.wait(lock);
+    }
+}
+
+bool FloorPreloader::IsReady(int floorNumber) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return finished.find(floorNumber) != finished.end();
+}
+
+void FloorPreloader::Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.clear();
+    finished.clear();
+
+    // A floor on the worker right now is dropped when it finishes
+    building = 0;
+    generation++;
+}
+
+double FloorPreloader::GetLastBuildMilliseconds() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return lastBuildMs;
+}
+
+bool FloorPreloader::IsKnown(int floorNumber) const {
+    if (building == floorNumber || finished.find(floorNumber) != finished.end()) {
+        return true;
+    }
+
+    for (const Job& job : pending) {
+        if (job.floorNumber == floorNumber) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FloorPreloader::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        workAvailable.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (stopping) {
+            return;
+        }
+
+        Job job = pending.front();
+        pending.pop_front();
+        building = job.floorNumber;
+        int jobGeneration = generation;
+        lock.unlock();
+
+        auto start = std::chrono::steady_clock::now();
+        std::shared_ptr<DungeonFloor> floor = generator.GenerateFloor(job.params);
+
+        // The handed-over floor must have no other owner
+        generator.Clear();
+
+        double elapsedMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+        lock.lock();
+        building = 0;
+        lastBuildMs = elapsedMs;
+        if (jobGeneration == generation) {
+            finished[job.floorNumber] = std::move(floor);
+        }
+        floorFinished.notify_all();
+    }
+}
+
+} // namespace Game 
\ No newline at end of file
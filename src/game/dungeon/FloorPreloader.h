@@ -0,0 +1,88 @@
+#pragma once
+
+#include "DungeonGenerator.h"
+#include <memory>
+#include <utility>
+#include <functional>
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Game {
+
+/**
+ * Builds upcoming dungeon floors on a background thread.
+ *
+ * While the player explores floor N, the preloader generates floors N+1 up
+ * to N+lookahead with its own quiet DungeonGenerator. Generation parameters
+ * are resolved on the calling thread when a floor is queued, so the
+ * provider never runs on the worker. TakeFloor hands a finished floor over
+ * and drops the preloader's reference: the worker never touches a floor
+ * again once it has been handed out.
+ */
+class FloorPreloader {
+public:
+    using ParamsProvider = std::function<DungeonGenerationParams(int floorNumber)>;
+
+    explicit FloorPreloader(ParamsProvider provider, int lookahead = 1);
+    ~FloorPreloader();
+
+    FloorPreloader(const FloorPreloader&) = delete;
+    FloorPreloader& operator=(const FloorPreloader&) = delete;
+
+    /**
+     * Queue the floors after the current one (up to the lookahead) and
+     * discard finished floors that are now behind the player
+     */
+    void PrepareAfter(int currentFloor);
+
+    /**
+     * Hand over a finished floor. Blocks if it is still being built and
+     * queues it first if it was never requested.
+     */
+    std::shared_ptr<DungeonFloor> TakeFloor(int floorNumber);
+
+    // Whether a floor is finished and can be taken without waiting
+    bool IsReady(int floorNumber) const;
+
+    // Drop every queued and finished floor (a floor being built is discarded)
+    void Clear();
+
+    // Number of floors built ahead of the current one
+    int GetLookahead() const { return lookahead; }
+    void SetLookahead(int floors) { lookahead = floors < 1 ? 1 : floors; }
+
+    // Time the worker spent on the most recent floor
+    double GetLastBuildMilliseconds() const;
+
+private:
+    struct Job {
+        int floorNumber;
+        DungeonGenerationParams params;
+    };
+
+    void WorkerLoop();
+    bool IsKnown(int floorNumber) const;
+
+    ParamsProvider provider;
+    int lookahead;
+
+    // Owned by the worker thread
+    DungeonGenerator generator;
+
+    mutable std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable floorFinished;
+    std::deque<Job> pending;
+    std::map<int, std::shared_ptr<DungeonFloor>> finished;
+    int building;           // Floor on the worker right now (0 if idle)
+    int generation;         // Bumped by Clear to discard in-flight work
+    bool stopping;
+    double lastBuildMs;
+
+    std::thread worker;
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include "FloorSerializer.h"
+#include "../../engine/core/MappedFile.h"
+#include <fstream>
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace Game {
+
+namespace {
+
+// On-disk layout. Sections start on 8-byte boundaries so the records can be
+// read in place from the (page-aligned) mapping.
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;
+    int32_t width;
+    int32_t height;
+    int32_t roomCount;
+    int32_t edgeCount;
+    int32_t floorNumber;
+    uint64_t seed;
+    uint64_t runSeed;
+    uint64_t roomsOffset;
+    uint64_t edgesOffset;
+    uint64_t visitedOffset;
+    uint64_t clearedOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t fileSize;
+};
+
+struct RoomRecord {
+    int32_t x;
+    int32_t y;
+    uint8_t type;
+    uint8_t encounterType;
+    uint8_t boss;
+    uint8_t reserved;
+    int32_t encounterLevel;
+    uint64_t encounterSeed;
+    uint32_t descriptionOffset;
+    uint32_t descriptionLength;
+};
+
+struct EdgeRecord {
+    int32_t a;
+    int32_t b;
+};
+
+// Far beyond any generated floor; keeps a corrupt header from asking for
+// an absurd grid allocation
+const uint64_t MAX_GRID_CELLS = 1ULL << 26;
+
+static_assert(sizeof(FileHeader) % 8 == 0, "Floor file header must keep sections aligned");
+static_assert(sizeof(RoomRecord) == 32, "Room records are part of the file format");
+static_assert(sizeof(EdgeRecord) == 8, "Edge records are part of the file format");
+
+uint64_t AlignUp(uint64_t value) {
+    return (value + 7) & ~static_cast<uint64_t>(7);
+}
+
+uint32_t ByteSwap32(uint32_t value) {
+    return ((value & 0xFF) << 24) | ((value & 0xFF00) << 8) |
+           ((value >> 8) & 0xFF00) | (value >> 24);
+}
+
+// Whether [offset, offset + bytes) lies inside a file of the given size
+bool SectionFits(uint64_t offset, uint64_t bytes, uint64_t fileSize) {
+    return offset % 8 == 0 && offset <= fileSize && bytes <= fileSize - offset;
+}
+
+bool TestBit(const uint64_t* bits, int index) {
+    return (bits[index >> 6] >> (index & 63)) & 1ULL;
+}
+
+void Fail(const std::string& filePath, const char* reason) {
+    std::cerr << "Error loading floor " << filePath << ": " << reason << std::endl;
+}
+
+} // namespace
+
+bool FloorSerializer::Save(const DungeonFloor& floor, const std::string& filePath, const FloorSaveInfo& info) {
+    const int roomCount = floor.GetRoomCount();
+    const auto& edges = floor.GetConnections();
+    const uint64_t bitsetWords = (static_cast<uint64_t>(roomCount) + 63) / 64;
+
+    // Room records, with descriptions deduplicated into a string table
+    // (most rooms share one of a handful of interned texts)
+    std::vector<RoomRecord> records(roomCount);
+    std::vector<uint64_t> visited(bitsetWords, 0);
+    std::vector<uint64_t> cleared(bitsetWords, 0);
+    std::vector<char> strings;
+    std::unordered_map<Engine::StringId, uint32_t> stringOffsets;
+
+    for (int i = 0; i < roomCount; ++i) {
+        const Room& room = floor.GetRoom(i);
+        const EncounterDescriptor& descriptor = room.GetEncounterDescriptor();
+        const std::string& description = room.GetDescription();
+
+        auto found = stringOffsets.find(room.GetDescriptionId());
+        if (found == stringOffsets.end()) {
+            found = stringOffsets.emplace(room.GetDescriptionId(), static_cast<uint32_t>(strings.size())).first;
+            strings.insert(strings.end(), description.begin(), description.end());
+        }
+
+        RoomRecord& record = records[i];
+        record.x = room.GetPositionX();
+        record.y = room.GetPositionY();
+        record.type = static_cast<uint8_t>(room.GetType());
+        record.encounterType = static_cast<uint8_t>(descriptor.type);
+        record.boss = descriptor.boss ? 1 : 0;
+        record.reserved = 0;
+        record.encounterLevel = descriptor.level;
+        record.encounterSeed = descriptor.seed;
+        record.descriptionOffset = found->second;
+        record.descriptionLength = static_cast<uint32_t>(description.size());
+
+        if (room.IsVisited()) visited[i >> 6] |= 1ULL << (i & 63);
+        if (room.IsCleared()) cleared[i >> 6] |= 1ULL << (i & 63);
+    }
+
+    FileHeader header = {};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.headerSize = sizeof(FileHeader);
+    header.width = floor.GetWidth();
+    header.height = floor.GetHeight();
+    header.roomCount = roomCount;
+    header.edgeCount = static_cast<int32_t>(edges.size());
+    header.floorNumber = info.floorNumber;
+    header.seed = floor.GetSeed();
+    header.runSeed = info.runSeed;
+    header.roomsOffset = AlignUp(sizeof(FileHeader));
+    header.edgesOffset = AlignUp(header.roomsOffset + records.size() * sizeof(RoomRecord));
+    header.visitedOffset = AlignUp(header.edgesOffset + edges.size() * sizeof(EdgeRecord));
+    header.clearedOffset = header.visitedOffset + bitsetWords * sizeof(uint64_t);
+    header.stringsOffset = header.clearedOffset + bitsetWords * sizeof(uint64_t);
+    header.stringsSize = strings.size();
+    header.fileSize = header.stringsOffset + strings.size();
+
+    // Lay the whole file out in memory, then write it in one go
+    std::vector<char> buffer(header.fileSize, 0);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    if (!records.empty()) {
+        std::memcpy(buffer.data() + header.roomsOffset, records.data(), records.size() * sizeof(RoomRecord));
+    }
+
+    EdgeRecord* edgeOut = reinterpret_cast<EdgeRecord*>(buffer.data() + header.edgesOffset);
+    for (const auto& edge : edges) {
+        edgeOut->a = edge.first;
+        edgeOut->b = edge.second;
+        ++edgeOut;
+    }
+
+    if (bitsetWords > 0) {
+        std::memcpy(buffer.data() + header.visitedOffset, visited.data(), bitsetWords * sizeof(uint64_t));
+        std::memcpy(buffer.data() + header.clearedOffset, cleared.data(), bitsetWords * sizeof(uint64_t));
+    }
+    if (!strings.empty()) {
+        std::memcpy(buffer.data() + header.stringsOffset, strings.data(), strings.size());
+    }
+
+    // Write next to the target and rename, so a failed save never leaves
+    // a truncated floor behind
+    std::string tempPath = filePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open file for writing: " << tempPath << std::endl;
+            return false;
+        }
+
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            std::cerr << "Error writing floor to " << tempPath << std::endl;
+            return false;
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), filePath.c_str()) != 0) {
+        std::cerr << "Error replacing floor file " << filePath << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<DungeonFloor> FloorSerializer::Load(const std::string& filePath, FloorSaveInfo* info) {
+    Engine::MappedFile mapping;
+    if (!mapping.Open(filePath)) {
+        return nullptr;
+    }
+
+    const unsigned char* data = mapping.GetData();
+    const uint64_t fileSize = mapping.GetSize();
+
+    // Header checks
+    if (fileSize < sizeof(FileHeader)) {
+        Fail(filePath, "file is too small");
+        return nullptr;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.magic != MAGIC) {
+        Fail(filePath, header.magic == ByteSwap32(MAGIC) ? "written with a different byte order" : "not a floor file");
+        return nullptr;
+    }
+    if (header.version != VERSION) {
+        Fail(filePath, "unsupported version");
+        return nullptr;
+    }
+    if (header.headerSize != sizeof(FileHeader) || header.fileSize != fileSize) {
+        Fail(filePath, "corrupt header");
+        return nullptr;
+    }
+
+    // Section checks: once these pass, every record can be read in place
+    const uint64_t cellCount = static_cast<uint64_t>(header.width < 0 ? 0 : header.width) *
+                               static_cast<uint64_t>(header.height < 0 ? 0 : header.height);
+    const uint64_t bitsetBytes = ((static_cast<uint64_t>(header.roomCount) + 63) / 64) * sizeof(uint64_t);
+
+    if (header.width < 0 || header.height < 0 || header.roomCount < 0 || header.edgeCount < 0 ||
+        cellCount > MAX_GRID_CELLS || static_cast<uint64_t>(header.roomCount) > cellCount ||
+        !SectionFits(header.roomsOffset, static_cast<uint64_t>(header.roomCount) * sizeof(RoomRecord), fileSize) ||
+        !SectionFits(header.edgesOffset, static_cast<uint64_t>(header.edgeCount) * sizeof(EdgeRecord), fileSize) ||
+        !SectionFits(header.visitedOffset, bitsetBytes, fileSize) ||
+        !SectionFits(header.clearedOffset, bitsetBytes, fileSize) ||
+        header.stringsOffset > fileSize || header.stringsSize > fileSize - header.stringsOffset) {
+        Fail(filePath, "section out of bounds");
+        return nullptr;
+    }
+
+    const RoomRecord* records = reinterpret_cast<const RoomRecord*>(data + header.roomsOffset);
+    const EdgeRecord* edgeRecords = reinterpret_cast<const EdgeRecord*>(data + header.edgesOffset);
+    const uint64_t* visited = reinterpret_cast<const uint64_t*>(data + header.visitedOffset);
+    const uint64_t* cleared = reinterpret_cast<const uint64_t*>(data + header.clearedOffset);
+    const char* strings = reinterpret_cast<const char*>(data + header.stringsOffset);
+
+    auto floor = std::make_shared<DungeonFloor>(header.width, header.height);
+    floor->SetSeed(header.seed);
+    floor->ReserveRooms(header.roomCount);
+
+    // String table offset -> (length, interned description)
+    std::unordered_map<uint32_t, std::pair<uint32_t, Engine::StringId>> descriptionIds;
+
+    for (int i = 0; i < header.roomCount; ++i) {
+        const RoomRecord& record = records[i];
+
+        if (record.type > static_cast<uint8_t>(RoomType::EXIT) ||
+            record.encounterType > static_cast<uint8_t>(EncounterType::EMPTY) ||
+            record.descriptionOffset > header.stringsSize ||
+            record.descriptionLength > header.stringsSize - record.descriptionOffset) {
+            Fail(filePath, "corrupt room record");
+            return nullptr;
+        }
+
+        // Rooms must come back at their own index, on free in-bounds cells
+        if (floor->AddRoom(static_cast<RoomType>(record.type), record.x, record.y) != i) {
+            Fail(filePath, "room position is invalid or taken");
+            return nullptr;
+        }
+
+        Room& room = floor->GetRoom(i);
+
+        // Rooms sharing a string table entry share its interned id
+        auto interned = descriptionIds.find(record.descriptionOffset);
+        if (interned == descriptionIds.end() || interned->second.first != record.descriptionLength) {
+            Engine::StringId id = Engine::StringInterner::GetInstance().Intern(
+                std::string_view(strings + record.descriptionOffset, record.descriptionLength));
+            interned = descriptionIds.insert_or_assign(record.descriptionOffset,
+                                                       std::make_pair(record.descriptionLength, id)).first;
+        }
+        room.SetDescription(interned->second.second);
+
+        EncounterDescriptor descriptor;
+        descriptor.type = static_cast<EncounterType>(record.encounterType);
+        descriptor.boss = record.boss != 0;
+        descriptor.level = record.encounterLevel;
+        descriptor.seed = record.encounterSeed;
+        room.SetEncounterDescriptor(descriptor);
+
+        room.RestoreProgress(TestBit(visited, i), TestBit(cleared, i));
+    }
+
+    // Edges go back in their saved order, so adjacency order (and with it
+    // navigation hints) matches the saved floor
+    for (int i = 0; i < header.edgeCount; ++i) {
+        if (!floor->Connect(edgeRecords[i].a, edgeRecords[i].b)) {
+            Fail(filePath, "corrupt connection");
+            return nullptr;
+        }
+    }
+
+    if (info) {
+        info->floorNumber = header.floorNumber;
+        info->runSeed = header.runSeed;
+    }
+
+    return floor;
+}
+
+} // namespace Game 
\ No newline at end of file
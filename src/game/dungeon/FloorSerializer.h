@@ -0,0 +1,46 @@
+#pragma once
+
+#include "DungeonFloor.h"
+#include <memory>
+#include <string>
+#include <cstdint>
+
+namespace Game {
+
+/**
+ * Run state stored next to a floor, so a descent can be resumed
+ */
+struct FloorSaveInfo {
+    int floorNumber = 1;
+    uint64_t runSeed = 0;
+};
+
+/**
+ * Versioned binary floor files.
+ *
+ * A file is a fixed header followed by flat sections: fixed-size room
+ * records (position, type, encounter descriptor, description reference),
+ * the edge list in insertion order, visited and cleared bitsets, and a
+ * deduplicated string table for room descriptions. Everything is written
+ * in one sequential write and read back from a read-only memory mapping:
+ * the loader validates section bounds once and then copies records
+ * straight out of the mapping, with no per-room parsing.
+ *
+ * Values are stored in the host's byte order; the magic number doubles as
+ * a byte-order check. Distance fields and materialized encounters are not
+ * stored, they are rebuilt on demand after loading.
+ */
+class FloorSerializer {
+public:
+    static constexpr uint32_t MAGIC = 0x4C464C52;   // "RLFL"
+    static constexpr uint32_t VERSION = 1;
+
+    // Write a floor to disk; returns false (and logs) on failure
+    static bool Save(const DungeonFloor& floor, const std::string& filePath,
+                     const FloorSaveInfo& info = FloorSaveInfo());
+
+    // Load a floor; returns nullptr (and logs) if the file is missing or invalid
+    static std::shared_ptr<DungeonFloor> Load(const std::string& filePath, FloorSaveInfo* info = nullptr);
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "Room.h"
-#include <algorithm>
+#include "encounters/EncounterFactory.h"
 #include <iostream>
 
 namespace Game {
@@ -13,86 +13,19 @@ Room::Room(int id, RoomType type)
       posY(0),
       encounter(nullptr) {
     
-    // Set default description based on room type
-    switch (type) {
-        case RoomType::NORMAL:
-            description = "A standard dungeon room with stone walls and dim lighting.";
-            break;
-        case RoomType::TREASURE:
-            description = "A room filled with glittering treasures and valuable items.";
-            break;
-        case RoomType::BOSS:
-            description = "A large chamber with ominous decorations, perfect for a powerful foe.";
-            break;
-        case RoomType::ENTRANCE:
-            description = "The entrance to this floor of the dungeon.";
-            break;
-        case RoomType::EXIT:
-            description = "A room with stairs leading to the next level of the dungeon.";
-            break;
-        default:
-            description = "An unremarkable room in the dungeon.";
-            break;
-    }
-    
-    std::cout << "Created room " << id << " of type " << static_cast<int>(type) << std::endl;
-}
-
-Room::~Room() {
-    std::cout << "Destroyed room " << id << std::endl;
-    // Clear connections to avoid circular references
-    connections.clear();
-}
-
-void Room::AddConnection(std::shared_ptr<Room> room) {
-    // Check if already connected
-    if (!room || IsConnectedTo(room->GetId())) {
-        return;
-    }
-    
-    // Add connection
-    connections.push_back(room);
-    
-    // Make connection bidirectional
-    if (!room->IsConnectedTo(id)) {
-        room->AddConnection(std::shared_ptr<Room>(this, [](Room*){})); // Non-owning pointer
-    }
+    // Default descriptions are interned once and shared by every room
+    static const Engine::StringId DEFAULT_DESCRIPTIONS[] = {
+        Engine::StringInterner::GetInstance().Intern("A standard dungeon room with stone walls and dim lighting."),
+        Engine::StringInterner::GetInstance().Intern("A room filled with glittering treasures and valuable items."),
+        Engine::StringInterner::GetInstance().Intern("A large chamber with ominous decorations, perfect for a powerful foe."),
+        Engine::StringInterner::GetInstance().Intern("The entrance to this floor of the dungeon."),
+        Engine::StringInterner::GetInstance().Intern("A room with stairs leading to the next level of the dungeon.")
+    };
+    static const Engine::StringId UNKNOWN_DESCRIPTION = Engine::StringInterner::GetInstance().Intern("An unremarkable room in the dungeon.");
     
-    std::cout << "Connected room " << id << " to room " << room->GetId() << std::endl;
-}
-
-void Room::RemoveConnection(int roomId) {
-    // Find and remove the connection
-    auto it = std::find_if(connections.begin(), connections.end(),
-                          [roomId](const std::shared_ptr<Room>& room) {
-                              return room->GetId() == roomId;
-                          });
-    
-    if (it != connections.end()) {
-        // Get the room before removing the connection
-        auto room = *it;
-        
-        // Remove the connection
-        connections.erase(it);
-        
-        // Remove the reverse connection
-        if (room && room->IsConnectedTo(id)) {
-            room->RemoveConnection(id);
-        }
-        
-        std::cout << "Removed connection between room " << id << " and room " << roomId << std::endl;
-    }
-}
-
-bool Room::IsConnectedTo(int roomId) const {
-    return std::any_of(connections.begin(), connections.end(),
-                      [roomId](const std::shared_ptr<Room>& room) {
-                          return room->GetId() == roomId;
-                      });
-}
-
-const std::vector<std::shared_ptr<Room>>& Room::GetConnections() const {
-    return connections;
+    int typeIndex = static_cast<int>(type);
+    description = (typeIndex >= 0 && typeIndex <= static_cast<int>(RoomType::EXIT))
+        ? DEFAULT_DESCRIPTIONS[typeIndex] : UNKNOWN_DESCRIPTION;
 }
 
 void Room::Visit() {
@@ -107,6 +40,19 @@ void Room::Clear() {
         cleared = true;
         std::cout << "Room " << id << " has been cleared" << std::endl;
     }
+    
+    // A cleared room never needs its encounter again
+    encounter.reset();
+}
+
+std::shared_ptr<Encounter> Room::Enter() {
+    Visit();
+    
+    if (!encounter && !cleared && !encounterDescriptor.IsEmpty()) {
+        encounter = EncounterFactory::Create(encounterDescriptor, id);
+    }
+    
+    return encounter;
 }
 
 void Room::SetEncounter(std::shared_ptr<Encounter> newEncounter) {
@@ -117,20 +63,51 @@ std::shared_ptr<Encounter> Room::GetEncounter() const {
     return encounter;
 }
 
-void Room::SetProperty(const std::string& key, const std::string& value) {
-    properties[key] = value;
+void Room::SetProperty(std::string_view key, std::string_view value) {
+    Engine::StringInterner& interner = Engine::StringInterner::GetInstance();
+    SetProperty(interner.Intern(key), interner.Intern(value));
 }
 
-std::string Room::GetProperty(const std::string& key) const {
-    auto it = properties.find(key);
-    if (it != properties.end()) {
-        return it->second;
+void Room::SetProperty(Engine::StringId key, Engine::StringId value) {
+    for (auto& property : properties) {
+        if (property.first == key) {
+            property.second = value;
+            return;
+        }
     }
-    return "";
+    properties.emplace_back(key, value);
 }
 
-bool Room::HasProperty(const std::string& key) const {
-    return properties.find(key) != properties.end();
+const std::string& Room::GetProperty(std::string_view key) const {
+    // A key the interner has never seen cannot be set on any room
+    Engine::StringId keyId;
+    if (!Engine::StringInterner::GetInstance().Find(key, keyId)) {
+        return Engine::StringInterner::GetInstance().Get(Engine::StringInterner::EMPTY);
+    }
+    return GetProperty(keyId);
+}
+
+const std::string& Room::GetProperty(Engine::StringId key) const {
+    for (const auto& property : properties) {
+        if (property.first == key) {
+            return Engine::StringInterner::GetInstance().Get(property.second);
+        }
+    }
+    return Engine::StringInterner::GetInstance().Get(Engine::StringInterner::EMPTY);
+}
+
+bool Room::HasProperty(std::string_view key) const {
+    Engine::StringId keyId;
+    return Engine::StringInterner::GetInstance().Find(key, keyId) && HasProperty(keyId);
+}
+
+bool Room::HasProperty(Engine::StringId key) const {
+    for (const auto& property : properties) {
+        if (property.first == key) {
+            return true;
+        }
+    }
+    return false;
 }
 
 } // namespace Game 
\ No newline at end of file
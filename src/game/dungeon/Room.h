@@ -1,15 +1,16 @@
 #pragma once
 
 #include <string>
-#include <vector>
+#include <string_view>
 #include <memory>
-#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "encounters/Encounter.h"
+#include "../../engine/core/StringInterner.h"
 #include <functional>
 
 namespace Game {
 
-// Forward declarations
-class Encounter;
 
 // Enum for room types
 enum class RoomType {
@@ -21,41 +22,57 @@ enum class RoomType {
 };
 
 /**
- * Represents a single room in the dungeon
+ * Represents a single room in the dungeon.
+ * Rooms are stored by value in a DungeonFloor, which owns the layout and
+ * the connections between them.
  */
 class Room {
 public:
     Room(int id, RoomType type);
-    ~Room();
     
     // Getters
     int GetId() const { return id; }
     RoomType GetType() const { return type; }
-    const std::string& GetDescription() const { return description; }
+    const std::string& GetDescription() const { return Engine::StringInterner::GetInstance().Get(description); }
+    Engine::StringId GetDescriptionId() const { return description; }
     bool IsVisited() const { return visited; }
     bool IsCleared() const { return cleared; }
     
-    // Connected rooms
-    void AddConnection(std::shared_ptr<Room> room);
-    void RemoveConnection(int roomId);
-    bool IsConnectedTo(int roomId) const;
-    const std::vector<std::shared_ptr<Room>>& GetConnections() const;
+    // Change the room's role (connections live in the owning DungeonFloor)
+    void SetType(RoomType newType) { type = newType; }
     
-    // Visit and clear state
+    // Visit and clear state (clearing releases the room's encounter)
     void Visit();
     void Clear();
     
-    // Encounter management
+    // Restore saved progress without the visit/clear side effects
+    void RestoreProgress(bool wasVisited, bool wasCleared) { visited = wasVisited; cleared = wasCleared; }
+    
+    // Visit the room and materialize its encounter from the descriptor
+    std::shared_ptr<Encounter> Enter();
+    
+    // Encounter management. Rooms keep a compact descriptor; the encounter
+    // object only exists between entering the room and clearing it.
+    void SetEncounterDescriptor(const EncounterDescriptor& descriptor) { encounterDescriptor = descriptor; }
+    const EncounterDescriptor& GetEncounterDescriptor() const { return encounterDescriptor; }
+    bool HasEncounter() const { return !encounterDescriptor.IsEmpty() || encounter != nullptr; }
+    bool IsEncounterMaterialized() const { return encounter != nullptr; }
     void SetEncounter(std::shared_ptr<Encounter> encounter);
     std::shared_ptr<Encounter> GetEncounter() const;
     
-    // Properties
-    void SetProperty(const std::string& key, const std::string& value);
-    std::string GetProperty(const std::string& key) const;
-    bool HasProperty(const std::string& key) const;
+    // Properties. Keys and values are interned; the id overloads skip
+    // the interner lookup for keys the caller interned up front.
+    void SetProperty(std::string_view key, std::string_view value);
+    void SetProperty(Engine::StringId key, Engine::StringId value);
+    const std::string& GetProperty(std::string_view key) const;
+    const std::string& GetProperty(Engine::StringId key) const;
+    bool HasProperty(std::string_view key) const;
+    bool HasProperty(Engine::StringId key) const;
+    size_t GetPropertyCount() const { return properties.size(); }
     
-    // Set room description
-    void SetDescription(const std::string& desc) { description = desc; }
+    // Set room description (shared through the string interner)
+    void SetDescription(std::string_view desc) { description = Engine::StringInterner::GetInstance().Intern(desc); }
+    void SetDescription(Engine::StringId desc) { description = desc; }
     
     // Position in the dungeon layout (for visualization)
     void SetPosition(int x, int y) { posX = x; posY = y; }
@@ -65,7 +82,7 @@ public:
 private:
     int id;                     // Unique identifier
     RoomType type;              // Type of room
-    std::string description;    // Room description
+    Engine::StringId description;         // Room description (interned)
     bool visited;               // Has player visited
     bool cleared;               // Has encounter been cleared
     
@@ -73,14 +90,13 @@ private:
     int posX;
     int posY;
     
-    // Connected rooms
-    std::vector<std::shared_ptr<Room>> connections;
-    
-    // Room encounter
+    // Room encounter: descriptor plus the materialized object while live
+    EncounterDescriptor encounterDescriptor;
     std::shared_ptr<Encounter> encounter;
     
-    // Custom properties
-    std::unordered_map<std::string, std::string> properties;
+    // Custom properties: a small flat map of interned key/value pairs.
+    // Rooms carry few properties, so a linear scan beats hashing.
+    std::vector<std::pair<Engine::StringId, Engine::StringId>> properties;
 };
 
 } // namespace Game 
\ No newline at end of file
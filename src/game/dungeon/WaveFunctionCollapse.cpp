@@ -0,0 +1,269 @@
+#include "WaveFunctionCollapse.h"
+#include "DungeonSeed.h"
+#include <algorithm>
+
+namespace Game {
+
+namespace {
+
+// Door directions (right, down, left, up), matching DungeonFloor's door bits
+const int DIR_X[4] = {1, 0, -1, 0};
+const int DIR_Y[4] = {0, 1, 0, -1};
+const int OPPOSITE[4] = {2, 3, 0, 1};
+
+const uint16_t ALL_TILES = 0xFFFF;
+
+// While rooms are still missing and this few cells are open, each of them
+// must open a new door, so the growing floor is unlikely to seal itself off
+const int MIN_OPEN_CELLS = 4;
+
+// TILES_WITH_DOOR[d]: the set of tiles that have a door in direction d
+// (tile t has the door when bit d of t is set)
+constexpr uint16_t TilesWithDoor(int dir) {
+    uint16_t mask = 0;
+    for (int tile = 0; tile < WaveFunctionCollapse::TILE_COUNT; ++tile) {
+        if (tile & (1 << dir)) {
+            mask |= static_cast<uint16_t>(1u << tile);
+        }
+    }
+    return mask;
+}
+
+const uint16_t TILES_WITH_DOOR[4] = {TilesWithDoor(0), TilesWithDoor(1), TilesWithDoor(2), TilesWithDoor(3)};
+
+// Fixed-point scale for tile weights, so picks need no floating point
+const float WEIGHT_SCALE = 65536.0f;
+
+// Number of tiles in a domain (16-bit population count)
+int TileCount(uint16_t domain) {
+    unsigned bits = domain;
+    bits = bits - ((bits >> 1) & 0x5555u);
+    bits = (bits & 0x3333u) + ((bits >> 2) & 0x3333u);
+    bits = (bits + (bits >> 4)) & 0x0F0Fu;
+    return static_cast<int>((bits + (bits >> 8)) & 0x1Fu);
+}
+
+// Index of the lowest tile in a non-empty domain (De Bruijn bit scan)
+int LowestTile(uint16_t domain) {
+    static const uint8_t DE_BRUIJN_INDEX[32] = {
+        0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+    };
+    uint32_t lowest = domain & (0u - domain);
+    return DE_BRUIJN_INDEX[(lowest * 0x077CB531u) >> 27];
+}
+
+// Draw a number in [0, range) from the high bits of one SplitMix64 step
+uint32_t Draw(uint64_t& rngState, uint32_t range) {
+    uint64_t draw = DungeonSeed::SplitMix64(rngState) >> 32;
+    return static_cast<uint32_t>((draw * range) >> 32);
+}
+
+} // namespace
+
+std::vector<float> WaveFunctionCollapse::MakeRoomWeights() {
+    // Share of rooms by door count, spread evenly over the tiles with that
+    // many doors (4, 6, 4 and 1 of them)
+    const float byDoorCount[5] = {0.0f, 0.15f / 4, 0.55f / 6, 0.25f / 4, 0.05f};
+
+    std::vector<float> weights(TILE_COUNT);
+    for (int tile = 0; tile < TILE_COUNT; ++tile) {
+        weights[tile] = byDoorCount[TileCount(static_cast<uint16_t>(tile))];
+    }
+    return weights;
+}
+
+void WaveFunctionCollapse::SetWeights(const std::vector<float>& tileWeights) {
+    for (int tile = 0; tile < TILE_COUNT; ++tile) {
+        float weight = tile < static_cast<int>(tileWeights.size()) ? tileWeights[tile] : 0.0f;
+        weights[tile] = static_cast<uint32_t>(std::max(weight, 0.0f) * WEIGHT_SCALE);
+    }
+}
+
+bool WaveFunctionCollapse::Solve(int gridWidth, int gridHeight, std::initializer_list<int> requiredRooms,
+                                 int roomBudget, uint64_t& rngState) {
+    Reset(gridWidth, gridHeight);
+
+    const int cellCount = width * height;
+    for (int cell : requiredRooms) {
+        if (cell < 0 || cell >= cellCount || TileCount(domains[cell]) == 1) {
+            continue;
+        }
+        uint16_t rooms = domains[cell] & ~static_cast<uint16_t>(1u << EMPTY_TILE);
+        Collapse(cell, rooms != 0 ? rooms : domains[cell], rngState);
+    }
+
+    for (int cell = PickLowestEntropyCell(rngState); cell >= 0; cell = PickLowestEntropyCell(rngState)) {
+        const uint16_t fewestDoors = FewestDoors(domains[cell]);
+
+        if (roomsPlaced >= roomBudget) {
+            // Over budget: close the cell with only the doors leading into
+            // it, which opens nothing new
+            Collapse(cell, fewestDoors, rngState);
+        } else if (openCells <= MIN_OPEN_CELLS) {
+            Collapse(cell, domains[cell] & ~fewestDoors, rngState);
+        } else {
+            Collapse(cell, domains[cell], rngState);
+        }
+    }
+
+    // Cells never observed keep tile 0 (tiles starts out empty): no
+    // collapsed room has a door into them, so that is always consistent
+    return roomsPlaced >= roomBudget;
+}
+
+void WaveFunctionCollapse::Reset(int gridWidth, int gridHeight) {
+    roomsPlaced = 0;
+    openCells = 0;
+
+    if (gridWidth != wallWidth || gridHeight != wallHeight) {
+        width = gridWidth;
+        height = gridHeight;
+        BuildWalledDomains();
+        domains = walledDomains;
+        tiles.assign(width * height, EMPTY_TILE);
+        bucketSlots.assign(width * height, -1);
+        touched.clear();
+        return;
+    }
+
+    // Same grid: only cells the last solve narrowed differ from an empty
+    // grid. The last solve also drained every bucket before returning.
+    for (int cell : touched) {
+        domains[cell] = walledDomains[cell];
+        tiles[cell] = EMPTY_TILE;
+        bucketSlots[cell] = -1;
+    }
+    touched.clear();
+}
+
+void WaveFunctionCollapse::BuildWalledDomains() {
+    // The grid edge acts as a wall: no tile may open a door through it.
+    // Interior cells keep every tile. Edge cells can still stay empty, so
+    // none of them is bucketed and the result is the same for every solve.
+    walledDomains.assign(width * height, ALL_TILES);
+    for (int x = 0; x < width; ++x) {
+        walledDomains[x] &= ~TILES_WITH_DOOR[3];
+        walledDomains[(height - 1) * width + x] &= ~TILES_WITH_DOOR[1];
+    }
+    for (int y = 0; y < height; ++y) {
+        walledDomains[y * width] &= ~TILES_WITH_DOOR[2];
+        walledDomains[y * width + width - 1] &= ~TILES_WITH_DOOR[0];
+    }
+    wallWidth = width;
+    wallHeight = height;
+}
+
+uint16_t WaveFunctionCollapse::FewestDoors(uint16_t domain) {
+    // Domains are products of per-door choices, so the tile without any
+    // optional door is the lowest one
+    return static_cast<uint16_t>(1u << LowestTile(domain));
+}
+
+void WaveFunctionCollapse::Restrict(int cell, uint16_t allowed) {
+    const uint16_t previous = domains[cell];
+    const uint16_t domain = previous & allowed;
+    if (domain == previous) {
+        return;
+    }
+
+    // Domains only ever shrink, so this is the cell's first change
+    if (previous == walledDomains[cell]) {
+        touched.push_back(cell);
+    }
+    domains[cell] = domain;
+    Rebucket(cell, previous);
+}
+
+void WaveFunctionCollapse::Rebucket(int cell, uint16_t previous) {
+    // Unlink from the current bucket by moving its last entry into the gap
+    int slot = bucketSlots[cell];
+    if (slot >= 0) {
+        std::vector<int>& bucket = buckets[TileCount(previous)];
+        int last = bucket.back();
+        bucket[slot] = last;
+        bucketSlots[last] = slot;
+        bucket.pop_back();
+        bucketSlots[cell] = -1;
+        openCells--;
+    }
+
+    const uint16_t domain = domains[cell];
+    int count = TileCount(domain);
+    if (count == 1) {
+        tiles[cell] = static_cast<uint8_t>(LowestTile(domain));
+        if (tiles[cell] != EMPTY_TILE) {
+            roomsPlaced++;
+        }
+        Propagate(cell);
+        return;
+    }
+
+    // Cells that may still stay empty wait until a door leads into them
+    if (domain & (1u << EMPTY_TILE)) {
+        return;
+    }
+
+    bucketSlots[cell] = static_cast<int>(buckets[count].size());
+    buckets[count].push_back(cell);
+    openCells++;
+}
+
+void WaveFunctionCollapse::Propagate(int cell) {
+    // Domains stay products of independent per-door choices, so narrowing
+    // one side of a neighbour never changes what its other sides allow:
+    // a single step from the collapsed cell is complete
+    const int tile = tiles[cell];
+    const int x = cell % width;
+    const int y = cell / width;
+
+    for (int dir = 0; dir < 4; ++dir) {
+        int nx = x + DIR_X[dir];
+        int ny = y + DIR_Y[dir];
+        if (nx < 0 || ny < 0 || nx >= width || ny >= height) {
+            continue;
+        }
+
+        // The neighbour keeps exactly the tiles that agree on the shared door
+        const uint16_t facing = TILES_WITH_DOOR[OPPOSITE[dir]];
+        Restrict(ny * width + nx, (tile & (1 << dir)) ? facing : static_cast<uint16_t>(~facing));
+    }
+}
+
+void WaveFunctionCollapse::Collapse(int cell, uint16_t candidates, uint64_t& rngState) {
+    uint32_t total = 0;
+    for (uint16_t rest = candidates; rest != 0; rest &= rest - 1) {
+        total += weights[LowestTile(rest)];
+    }
+
+    int chosen = LowestTile(candidates);
+    if (total > 0) {
+        uint32_t roll = Draw(rngState, total);
+        for (uint16_t rest = candidates; rest != 0; rest &= rest - 1) {
+            int tile = LowestTile(rest);
+            if (roll < weights[tile]) {
+                chosen = tile;
+                break;
+            }
+            roll -= weights[tile];
+        }
+    }
+
+    Restrict(cell, static_cast<uint16_t>(1u << chosen));
+}
+
+int WaveFunctionCollapse::PickLowestEntropyCell(uint64_t& rngState) {
+    for (int count = 2; count <= TILE_COUNT; ++count) {
+        const std::vector<int>& bucket = buckets[count];
+        if (!bucket.empty()) {
+            // Random pick among the equally constrained cells
+            if (bucket.size() == 1) {
+                return bucket[0];
+            }
+            return bucket[Draw(rngState, static_cast<uint32_t>(bucket.size()))];
+        }
+    }
+    return -1;
+}
+
+} // namespace Game 
\ No newline at end of file
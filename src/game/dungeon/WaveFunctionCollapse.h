@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace Game {
+
+/**
+ * Wave function collapse over door tiles.
+ *
+ * Every cell takes one of 16 tiles: a 4-bit door mask (right, down, left,
+ * up, the same bits DungeonFloor uses), where tile 0 is an empty cell with
+ * no room. A cell's domain is the 16-bit set of tiles it may still take.
+ * Neighbouring cells must agree on the door between them, so propagation
+ * works on whole domains at once: one AND against a per-direction mask
+ * tells whether every, no or some remaining tile has a door on that side,
+ * and the neighbour's domain is narrowed with a single AND as well.
+ *
+ * Because every combination of door bits is a tile, propagation can never
+ * empty a domain, and the solver needs no backtracking. Only cells that
+ * must hold a room (a door leads into them, so tile 0 has left their
+ * domain) are observed; every other cell can always settle on tile 0, so
+ * the work follows the number of rooms rather than the size of the grid.
+ * The lowest-entropy cell is found through buckets keyed by domain size.
+ *
+ * Solves on the same grid size reuse their buffers: only the cells the
+ * previous solve touched are reset, and the buckets always end up empty.
+ */
+class WaveFunctionCollapse {
+public:
+    static constexpr int TILE_COUNT = 16;
+    static constexpr uint8_t EMPTY_TILE = 0;
+
+    /**
+     * Relative weights per tile. Door counts drive the layout's shape:
+     * mostly corridors (two doors), with junctions and dead ends mixed in.
+     */
+    static std::vector<float> MakeRoomWeights();
+
+    /**
+     * Set the relative weight of each tile, used by every following solve
+     */
+    void SetWeights(const std::vector<float>& weights);
+
+    /**
+     * Collapse a width x height grid, growing rooms out from the required
+     * cells until roomBudget rooms are placed; after that, open doors are
+     * closed with the fewest doors each cell allows. Returns false if the
+     * rooms sealed themselves off short of the budget (the caller may
+     * retry, as with any contradiction in wave function collapse).
+     * A solve makes only a few draws per room, so they come straight from
+     * a SplitMix64 state (see DungeonSeed) rather than a full engine.
+     */
+    bool Solve(int width, int height, std::initializer_list<int> requiredRooms, int roomBudget,
+               uint64_t& rngState);
+
+    // Door mask of every cell after Solve (EMPTY_TILE for no room)
+    const std::vector<uint8_t>& GetTiles() const { return tiles; }
+
+private:
+    void Reset(int gridWidth, int gridHeight);
+    void BuildWalledDomains();
+    void Restrict(int cell, uint16_t allowed);
+    void Rebucket(int cell, uint16_t previous);
+    void Propagate(int cell);
+    static uint16_t FewestDoors(uint16_t domain);
+    void Collapse(int cell, uint16_t candidates, uint64_t& rngState);
+    int PickLowestEntropyCell(uint64_t& rngState);
+
+    int width = 0;
+    int height = 0;
+    uint32_t weights[TILE_COUNT] = {};
+    int roomsPlaced = 0;
+    int openCells = 0;
+
+    std::vector<uint16_t> domains;
+    std::vector<uint8_t> tiles;
+
+    // Domains of an empty grid with its edges walled off, kept while the
+    // grid size stays the same
+    std::vector<uint16_t> walledDomains;
+    int wallWidth = 0;
+    int wallHeight = 0;
+
+    // Cells whose domain has narrowed since the last reset
+    std::vector<int> touched;
+
+    // Cells that must hold a room but are still open, grouped by domain size, with each cell's place in its
+    // bucket so it can move in O(1) when its domain shrinks
+    std::vector<int> buckets[TILE_COUNT + 1];
+    std::vector<int> bucketSlots;
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -2,12 +2,37 @@
 #include "../../entities/components/StatsComponent.h"
 #include "../../entities/components/PositionComponent.h"
 #include "../../entities/components/StatusEffectsComponent.h"
+#include "../../entities/components/ActionSetComponent.h"
+#include "../../combat/CombatLog.h"
+#include "../../../data/ActionDataLoader.h"
+#include "../../../data/EnemyTable.h"
+#include "../../../data/ContentPipeline.h"
+#include "../DungeonSeed.h"
+#include <algorithm>
 #include <iostream>
 #include <random>
 #include <sstream>
 
 namespace Game {
 
+namespace {
+
+// Used when no enemy archetypes are loaded or none can spawn at a difficulty
+const EnemyData& GetGenericEnemy() {
+    static const EnemyData generic = []() {
+        EnemyData data;
+        data.SetName("Enemy");
+        data.SetHealth(20, 5);
+        data.AddAction("slash");
+        data.AddAction("advance");
+        data.AddAction("retreat");
+        return data;
+    }();
+    return generic;
+}
+
+} // namespace
+
 CombatEncounter::CombatEncounter(const std::string& name, int difficulty)
     : Encounter(EncounterType::COMBAT, name),
       difficulty(std::max(1, difficulty)),
@@ -30,7 +55,7 @@ CombatEncounter::CombatEncounter(const std::string& name, int difficulty)
 
 void CombatEncounter::Start() {
     if (!completed && !isActive) {
-        std::cout << "Starting combat encounter: " << name << std::endl;
+        CombatLog::Out() << "Starting combat encounter: " << name << std::endl;
         
         // Ensure we have some enemies
         if (enemyTeam.empty()) {
@@ -38,6 +63,11 @@ void CombatEncounter::Start() {
             GenerateEnemies(1 + difficulty / 2);
         }
         
+        // The encounter seed also fixes every roll of the fight, on its own
+        // stream so the enemy group and the dice don't share numbers
+        std::mt19937 combatGen = DungeonSeed::MakeEngine(DungeonSeed::Derive(seed, SeedStream::COMBAT));
+        combatSystem.Seed(combatGen());
+        
         // Start combat
         combatSystem.StartCombat(playerTeam, enemyTeam);
         isActive = true;
@@ -53,21 +83,7 @@ void CombatEncounter::Update(float deltaTime) {
         CombatResult result = combatSystem.CheckCombatResult();
         if (result != CombatResult::NONE) {
             // Map combat result to encounter result
-            EncounterResult encounterResult;
-            switch (result) {
-                case CombatResult::PLAYER_VICTORY:
-                    encounterResult = EncounterResult::VICTORY;
-                    break;
-                case CombatResult::PLAYER_DEFEAT:
-                    encounterResult = EncounterResult::DEFEAT;
-                    break;
-                case CombatResult::ESCAPE:
-                    encounterResult = EncounterResult::SKIPPED;
-                    break;
-                default:
-                    encounterResult = EncounterResult::NONE;
-                    break;
-            }
+            EncounterResult encounterResult = ToEncounterResult(result);
             
             // Complete the encounter if we have a result
             if (encounterResult != EncounterResult::NONE) {
@@ -77,6 +93,89 @@ void CombatEncounter::Update(float deltaTime) {
     }
 }
 
+AutoResolveSummary CombatEncounter::AutoResolve(int maxTurns) {
+    AutoResolveSummary summary;
+    if (completed) {
+        summary.result = result;
+        return summary;
+    }
+    
+    // Total health of a team, used to measure the damage exchanged
+    auto teamHealth = [](const std::vector<std::shared_ptr<Entity>>& team) {
+        int total = 0;
+        for (const auto& entity : team) {
+            if (entity && entity->HasComponent<StatsComponent>()) {
+                total += entity->GetComponent<StatsComponent>().GetCurrentHealth();
+            }
+        }
+        return total;
+    };
+    
+    {
+        // No narration while the battle plays out; only this thread's
+        // combat log is silenced, other output is untouched
+        CombatLog::Scope silence(CombatLog::Silent());
+        
+        Start();
+        int playerHealthBefore = teamHealth(playerTeam);
+        int enemyHealthBefore = teamHealth(enemyTeam);
+        
+        // Drive the turn loop directly instead of waiting for Update
+        while (summary.turns < maxTurns && 
+               combatSystem.CheckCombatResult() == CombatResult::NONE &&
+               combatSystem.ProcessAutoTurn()) {
+            summary.turns++;
+        }
+        
+        summary.rounds = combatSystem.GetTurnManager().GetCurrentRound();
+        summary.damageTaken = playerHealthBefore - teamHealth(playerTeam);
+        summary.damageDealt = enemyHealthBefore - teamHealth(enemyTeam);
+        
+        for (const auto& entity : enemyTeam) {
+            if (entity && entity->HasComponent<StatsComponent>() && 
+                entity->GetComponent<StatsComponent>().IsDead()) {
+                summary.enemiesDefeated++;
+            }
+        }
+        for (const auto& entity : playerTeam) {
+            if (entity && entity->HasComponent<StatsComponent>() && 
+                entity->GetComponent<StatsComponent>().IsDead()) {
+                summary.playersDefeated++;
+            }
+        }
+        
+        // A fight that never ends counts as skipped
+        summary.result = ToEncounterResult(combatSystem.CheckCombatResult());
+        if (summary.result == EncounterResult::NONE) {
+            summary.result = EncounterResult::SKIPPED;
+        }
+        
+        Complete(summary.result);
+        
+        // Hand cooldowns back and release the battlefield
+        combatSystem.Reset();
+    }
+    
+    CombatLog::Out() << "Auto-resolved " << name << ": " << summary.turns << " turns over " 
+                     << summary.rounds << " rounds, " << summary.damageDealt << " damage dealt, " 
+                     << summary.damageTaken << " damage taken" << std::endl;
+    
+    return summary;
+}
+
+EncounterResult CombatEncounter::ToEncounterResult(CombatResult result) {
+    switch (result) {
+        case CombatResult::PLAYER_VICTORY:
+            return EncounterResult::VICTORY;
+        case CombatResult::PLAYER_DEFEAT:
+            return EncounterResult::DEFEAT;
+        case CombatResult::ESCAPE:
+            return EncounterResult::SKIPPED;
+        default:
+            return EncounterResult::NONE;
+    }
+}
+
 bool CombatEncounter::IsActive() const {
     return isActive && !completed;
 }
@@ -103,145 +202,70 @@ void CombatEncounter::GenerateEnemies(int count) {
     // Clear existing enemies
     enemyTeam.clear();
     
+    // Archetypes and their action loadouts come from content still loading on the pipeline
+    ContentPipeline::GetInstance().WaitUntilReady();
+    
+    // The encounter seed fully determines the enemy group
+    std::mt19937 gen = DungeonSeed::MakeEngine(seed);
+    
     // Generate new enemies
     for (int i = 0; i < count; ++i) {
         // Create enemy with level based on difficulty
-        auto enemy = CreateRandomEnemy(difficulty);
+        auto enemy = CreateRandomEnemy(difficulty, gen);
         enemyTeam.push_back(enemy);
     }
     
-    std::cout << "Generated " << enemyTeam.size() << " enemies for encounter: " << name << std::endl;
+    CombatLog::Out() << "Generated " << enemyTeam.size() << " enemies for encounter: " << name << std::endl;
 }
 
 const std::vector<std::shared_ptr<Entity>>& CombatEncounter::GetEnemies() const {
     return enemyTeam;
 }
 
-std::shared_ptr<Entity> CombatEncounter::CreateRandomEnemy(int level) {
-    // Random engine
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    
-    // Generate random enemy type (0-2)
-    std::uniform_int_distribution<> typeDist(0, 2);
-    int enemyType = typeDist(gen);
+std::shared_ptr<Entity> CombatEncounter::CreateRandomEnemy(int level, std::mt19937& gen) {
+    // Pick an archetype from the difficulty tier's spawn table
+    const EnemyData* archetype = EnemyTable::GetInstance().Pick(difficulty, gen);
+    if (!archetype) {
+        archetype = &GetGenericEnemy();
+    }
     
-    // Create name based on type and randomness
+    // Create name based on archetype and randomness
     std::uniform_int_distribution<> idDist(1, 1000);
     int enemyId = idDist(gen);
     
     std::stringstream nameSs;
-    std::shared_ptr<Entity> enemy;
+    nameSs << archetype->GetName() << " #" << enemyId;
+    auto enemy = std::make_shared<Entity>(nameSs.str());
     
-    switch (enemyType) {
-        case 0: // Fast enemy
-            nameSs << "Quick Scout #" << enemyId;
-            enemy = std::make_shared<Entity>(nameSs.str());
-            
-            // Add stats component with focus on speed
-            {
-                auto& stats = enemy->AddComponent<StatsComponent>();
-                int baseStats = 5 + level;
-                stats.Initialize(
-                    baseStats,               // STR
-                    baseStats - 2,           // INT
-                    baseStats + 5,           // SPD
-                    baseStats + 3,           // DEX
-                    baseStats - 1,           // CON
-                    baseStats - 2,           // DEF
-                    baseStats + 2            // LCK
-                );
-                
-                // Health scales with level through Constitution
-                int desiredHealth = 18 + level * 4;
-                // Adjust CON to achieve target health (base health formula is 10 + (CON * 5))
-                int neededCon = (desiredHealth - 10) / 5;
-                stats.SetBaseStat(StatType::CONSTITUTION, neededCon);
-                stats.SetCurrentHealth(stats.GetMaxHealth());
-            }
-            break;
-            
-        case 1: // Strong enemy
-            nameSs << "Brute Warrior #" << enemyId;
-            enemy = std::make_shared<Entity>(nameSs.str());
-            
-            // Add stats component with focus on strength
-            {
-                auto& stats = enemy->AddComponent<StatsComponent>();
-                int baseStats = 5 + level;
-                stats.Initialize(
-                    baseStats + 5,           // STR
-                    baseStats - 3,           // INT
-                    baseStats - 1,           // SPD
-                    baseStats,               // DEX
-                    baseStats + 3,           // CON
-                    baseStats + 1,           // DEF
-                    baseStats - 2            // LCK
-                );
-                
-                // Health scales with level through Constitution
-                int desiredHealth = 20 + level * 5;
-                // Adjust CON to achieve target health (base health formula is 10 + (CON * 5))
-                int neededCon = (desiredHealth - 10) / 5;
-                stats.SetBaseStat(StatType::CONSTITUTION, neededCon);
-                stats.SetCurrentHealth(stats.GetMaxHealth());
-            }
-            break;
-            
-        case 2: // Magic enemy
-            nameSs << "Dark Mage #" << enemyId;
-            enemy = std::make_shared<Entity>(nameSs.str());
-            
-            // Add stats component with focus on intelligence
-            {
-                auto& stats = enemy->AddComponent<StatsComponent>();
-                int baseStats = 5 + level;
-                stats.Initialize(
-                    baseStats - 2,           // STR
-                    baseStats + 5,           // INT
-                    baseStats + 1,           // SPD
-                    baseStats - 1,           // DEX
-                    baseStats,               // CON
-                    baseStats - 2,           // DEF
-                    baseStats + 3            // LCK
-                );
-                
-                // Health scales with level through Constitution
-                int desiredHealth = 18 + level * 4;
-                // Adjust CON to achieve target health (base health formula is 10 + (CON * 5))
-                int neededCon = (desiredHealth - 10) / 5;
-                stats.SetBaseStat(StatType::CONSTITUTION, neededCon);
-                stats.SetCurrentHealth(stats.GetMaxHealth());
-            }
-            break;
-            
-        default:
-            // Fallback generic enemy
-            nameSs << "Enemy #" << enemyId;
-            enemy = std::make_shared<Entity>(nameSs.str());
-            
-            // Add stats component
-            {
-                auto& stats = enemy->AddComponent<StatsComponent>();
-                int baseStats = 5 + level;
-                stats.Initialize(
-                    baseStats,               // STR
-                    baseStats,               // INT
-                    baseStats,               // SPD
-                    baseStats,               // DEX
-                    baseStats,               // CON
-                    baseStats,               // DEF
-                    baseStats                // LCK
-                );
-                
-                // Health scales with level through Constitution
-                int desiredHealth = 20 + level * 5;
-                // Adjust CON to achieve target health (base health formula is 10 + (CON * 5))
-                int neededCon = (desiredHealth - 10) / 5;
-                stats.SetBaseStat(StatType::CONSTITUTION, neededCon);
-                stats.SetCurrentHealth(stats.GetMaxHealth());
-            }
-            break;
+    // Add stats component, offset from a level-based baseline
+    auto& stats = enemy->AddComponent<StatsComponent>();
+    int baseStats = 5 + level;
+    stats.Initialize(
+        baseStats + archetype->GetStatOffset(0),     // STR
+        baseStats + archetype->GetStatOffset(1),     // INT
+        baseStats + archetype->GetStatOffset(2),     // SPD
+        baseStats + archetype->GetStatOffset(3),     // DEX
+        baseStats + archetype->GetStatOffset(4),     // CON
+        baseStats + archetype->GetStatOffset(5),     // DEF
+        baseStats + archetype->GetStatOffset(6)      // LCK
+    );
+    
+    if (archetype->GetHealth() > 0) {
+        // Health scales with level through Constitution
+        int desiredHealth = archetype->GetHealth() + level * archetype->GetHealthPerLevel();
+        // Adjust CON to achieve target health (base health formula is 10 + (CON * 5))
+        int neededCon = (desiredHealth - 10) / 5;
+        stats.SetBaseStat(StatType::CONSTITUTION, neededCon);
+        stats.SetCurrentHealth(stats.GetMaxHealth());
+    }
+    
+    // Give the enemy its archetype loadout from the loaded action definitions
+    ActionDataLoader& actionLoader = ActionDataLoader::GetInstance();
+    auto& actionSet = enemy->AddComponent<ActionSetComponent>();
+    for (Engine::StringId actionId : archetype->GetActions()) {
+        if (actionLoader.HasAction(actionId)) {
+            actionSet.AddAction(actionLoader.GetActionRef(actionId));
+        }
     }
     
     // Add position component
@@ -4,9 +4,23 @@
 #include "../../combat/CombatSystem.h"
 #include "../../entities/Entity.h"
 #include <vector>
+#include <random>
 
 namespace Game {
 
+/**
+ * Outcome of an auto-resolved combat encounter
+ */
+struct AutoResolveSummary {
+    EncounterResult result = EncounterResult::NONE;
+    int rounds = 0;             // Combat rounds played
+    int turns = 0;              // Individual turns taken
+    int damageDealt = 0;        // Health removed from the enemy team
+    int damageTaken = 0;        // Health lost by the player team (net of healing)
+    int enemiesDefeated = 0;
+    int playersDefeated = 0;
+};
+
 /**
  * Combat encounter against enemies
  */
@@ -24,6 +38,10 @@ public:
     bool IsActive() const override;
     void Complete(EncounterResult result) override;
     
+    // Play the whole battle headlessly through the combat rules with the AI
+    // controlling both sides. Damage stays on the player team; stops at maxTurns.
+    AutoResolveSummary AutoResolve(int maxTurns = 500);
+    
     // Combat management
     void SetPlayerTeam(const std::vector<std::shared_ptr<Entity>>& team);
     void AddEnemy(std::shared_ptr<Entity> enemy);
@@ -41,7 +59,10 @@ private:
     float timeElapsed;
     
     // Enemy generation helper
-    std::shared_ptr<Entity> CreateRandomEnemy(int level);
+    std::shared_ptr<Entity> CreateRandomEnemy(int level, std::mt19937& gen);
+    
+    // Map the combat system's result to an encounter result
+    static EncounterResult ToEncounterResult(CombatResult result);
 };
 
 } // namespace Game 
\ No newline at end of file
@@ -1,14 +1,30 @@
 #include "Encounter.h"
+#include "../DungeonSeed.h"
+#include "../../combat/CombatLog.h"
+#include <atomic>
 #include <iostream>
 
 namespace Game {
 
+namespace {
+
+// Default seed for encounters built outside the generator: one random base
+// per process, advanced atomically so any thread can create encounters
+uint64_t NextDefaultSeed() {
+    static std::atomic<uint64_t> state{DungeonSeed::RandomSeed()};
+    uint64_t value = state.fetch_add(1);
+    return DungeonSeed::SplitMix64(value);
+}
+
+} // namespace
+
 Encounter::Encounter(EncounterType type, const std::string& name)
     : type(type),
       name(name),
       description(""),
       completed(false),
-      result(EncounterResult::NONE) {
+      result(EncounterResult::NONE),
+      seed(NextDefaultSeed()) {
     
     // Set default description based on encounter type
     switch (type) {
@@ -25,9 +41,6 @@ Encounter::Encounter(EncounterType type, const std::string& name)
             description = "An unknown encounter.";
             break;
     }
-    
-    std::cout << "Created encounter: " << name << " of type " 
-              << static_cast<int>(type) << std::endl;
 }
 
 void Encounter::Complete(EncounterResult encounterResult) {
@@ -35,8 +48,8 @@ void Encounter::Complete(EncounterResult encounterResult) {
         completed = true;
         result = encounterResult;
         
-        std::cout << "Encounter " << name << " completed with result: " 
-                  << static_cast<int>(result) << std::endl;
+        CombatLog::Out() << "Encounter " << name << " completed with result: " 
+                         << static_cast<int>(result) << std::endl;
     }
 }
 
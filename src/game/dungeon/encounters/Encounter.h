@@ -2,6 +2,7 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
 
 namespace Game {
 
@@ -28,6 +29,19 @@ enum class EncounterResult {
     SKIPPED     // Player skipped encounter
 };
 
+/**
+ * Compact description of a room's encounter. Rooms keep only this until
+ * they are entered; EncounterFactory turns it into a real encounter.
+ */
+struct EncounterDescriptor {
+    EncounterType type = EncounterType::EMPTY;
+    bool boss = false;          // Boss fight (combat only)
+    int level = 0;              // Combat difficulty or treasure quality
+    uint64_t seed = 0;          // Drives the enemies or loot
+    
+    bool IsEmpty() const { return type == EncounterType::EMPTY; }
+};
+
 /**
  * Base class for all room encounters
  */
@@ -42,10 +56,15 @@ public:
     const std::string& GetDescription() const { return description; }
     bool IsCompleted() const { return completed; }
     EncounterResult GetResult() const { return result; }
+    uint64_t GetSeed() const { return seed; }
     
     // Setters
     void SetDescription(const std::string& desc) { description = desc; }
     
+    // Seed that drives generated contents (enemies, loot). Encounters start
+    // with a random seed; the dungeon generator assigns a derived one.
+    void SetSeed(uint64_t newSeed) { seed = newSeed; }
+    
     // Encounter lifecycle
     virtual void Start() = 0;
     virtual void Update(float deltaTime) = 0;
@@ -60,6 +79,7 @@ protected:
     std::string description;
     bool completed;
     EncounterResult result;
+    uint64_t seed;
 };
 
 } // namespace Game 
\ No newline at end of file
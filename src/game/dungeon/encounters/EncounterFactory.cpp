@@ -0,0 +1,35 @@
+#include "EncounterFactory.h"
+#include "CombatEncounter.h"
+#include "TreasureEncounter.h"
+#include <sstream>
+
+namespace Game {
+
+std::shared_ptr<Encounter> EncounterFactory::Create(const EncounterDescriptor& descriptor, int roomId) {
+    std::shared_ptr<Encounter> encounter;
+    std::stringstream ss;
+    
+    switch (descriptor.type) {
+        case EncounterType::COMBAT:
+            // Create a unique name for the encounter
+            ss << (descriptor.boss ? "Boss Encounter " : "Combat Encounter ") << roomId;
+            encounter = std::make_shared<CombatEncounter>(ss.str(), descriptor.level);
+            break;
+            
+        case EncounterType::TREASURE:
+            // Create a unique name for the encounter
+            ss << "Treasure Chest " << roomId;
+            encounter = std::make_shared<TreasureEncounter>(ss.str(), descriptor.level);
+            break;
+            
+        // Nothing to build for empty rooms
+        default:
+            return nullptr;
+    }
+    
+    // The descriptor seed fixes the enemies or loot
+    encounter->SetSeed(descriptor.seed);
+    return encounter;
+}
+
+} // namespace Game 
\ No newline at end of file
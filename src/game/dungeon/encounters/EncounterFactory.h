@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Encounter.h"
+#include <memory>
+
+namespace Game {
+
+/**
+ * Builds encounters from the descriptors stored in rooms
+ */
+class EncounterFactory {
+public:
+    // Create the encounter for a room (nullptr for an empty descriptor)
+    static std::shared_ptr<Encounter> Create(const EncounterDescriptor& descriptor, int roomId);
+};
+
+} // namespace Game 
\ No newline at end of file
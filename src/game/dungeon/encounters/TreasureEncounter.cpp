@@ -1,10 +1,19 @@
 #include "TreasureEncounter.h"
+#include "../DungeonSeed.h"
+#include "../../../data/ContentPipeline.h"
 #include <iostream>
 #include <random>
 #include <sstream>
 
 namespace Game {
 
+namespace {
+
+const Engine::StringId TREASURE_TABLE = Engine::StringInterner::GetInstance().Intern("treasure");
+const Engine::StringId GOLD_ITEM = Engine::StringInterner::GetInstance().Intern("gold_coins");
+
+} // namespace
+
 TreasureEncounter::TreasureEncounter(const std::string& name, int quality)
     : Encounter(EncounterType::TREASURE, name),
       quality(std::max(1, quality)),
@@ -65,8 +74,13 @@ void TreasureEncounter::Complete(EncounterResult result) {
     
     // Log the loot obtained
     std::cout << "Treasure encounter completed! Items obtained:" << std::endl;
+    ContentPipeline::GetInstance().WaitUntilReady();
+    const ItemLoader& itemData = ContentPipeline::GetInstance().GetItems();
     for (const auto& item : items) {
-        std::cout << "- " << item.name << " (" << item.value << " gold)" << std::endl;
+        const ItemData* data = itemData.GetItem(item.itemId);
+        std::cout << "- " << item.count << "x "
+                  << (data ? data->GetName() : Engine::StringInterner::GetInstance().Get(item.itemId))
+                  << " (" << (data ? data->GetValue() * item.count : 0) << " gold)" << std::endl;
     }
 }
 
@@ -78,106 +92,23 @@ void TreasureEncounter::GenerateTreasure() {
     // Clear existing items
     items.clear();
     
-    // Generate items based on quality
-    int itemCount = 1 + quality / 2;
-    
-    for (int i = 0; i < itemCount; ++i) {
-        // Create item with value based on quality
-        auto item = CreateRandomTreasure(quality);
-        items.push_back(item);
-    }
-    
-    std::cout << "Generated " << items.size() << " treasure items for encounter: " << name << std::endl;
-}
-
-TreasureItem TreasureEncounter::CreateRandomTreasure(int level) {
-    // Random engine
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    
-    // Generate random treasure type (0-3)
-    std::uniform_int_distribution<> typeDist(0, 3);
-    int treasureType = typeDist(gen);
-    
-    // Create ID based on type and randomness
-    std::uniform_int_distribution<> idDist(1, 1000);
-    int itemId = idDist(gen);
+    // Roll the treasure table more often for better chests
+    int rollCount = 1 + quality / 2;
     
-    std::stringstream idSs;
-    std::string name, description;
-    int baseValue = 10 * level;
+    // The encounter seed fully determines the loot
+    std::mt19937 gen = DungeonSeed::MakeEngine(seed);
     
-    switch (treasureType) {
-        case 0: // Gold
-            idSs << "gold_" << itemId;
-            name = "Gold Coins";
-            description = "A pile of shiny gold coins.";
-            baseValue = 5 * level + (level * level);
-            break;
-            
-        case 1: // Weapon
-            idSs << "weapon_" << itemId;
-            
-            if (level <= 2) {
-                name = "Common Sword";
-                description = "A basic but functional sword.";
-            } else if (level <= 4) {
-                name = "Quality Blade";
-                description = "A well-crafted blade of good steel.";
-                baseValue *= 2;
-            } else {
-                name = "Legendary Weapon";
-                description = "A weapon of extraordinary power.";
-                baseValue *= 5;
-            }
-            break;
-            
-        case 2: // Armor
-            idSs << "armor_" << itemId;
-            
-            if (level <= 2) {
-                name = "Leather Armor";
-                description = "Basic protective gear made of leather.";
-            } else if (level <= 4) {
-                name = "Chain Mail";
-                description = "Metal rings linked together for protection.";
-                baseValue *= 2;
-            } else {
-                name = "Enchanted Plate";
-                description = "Magical armor that seems to move with you.";
-                baseValue *= 5;
-            }
-            break;
-            
-        case 3: // Potion
-            idSs << "potion_" << itemId;
-            
-            if (level <= 2) {
-                name = "Minor Healing Potion";
-                description = "Restores a small amount of health.";
-            } else if (level <= 4) {
-                name = "Healing Potion";
-                description = "Restores a significant amount of health.";
-                baseValue *= 1.5;
-            } else {
-                name = "Elixir of Life";
-                description = "Completely restores health and grants temporary invulnerability.";
-                baseValue *= 3;
-            }
-            break;
-            
-        default:
-            idSs << "item_" << itemId;
-            name = "Mysterious Item";
-            description = "An unidentified object of unknown origin.";
-            break;
+    // Loot tables are loaded by the content pipeline
+    ContentPipeline::GetInstance().WaitUntilReady();
+    const LootTables& lootTables = LootTables::GetInstance();
+    for (int i = 0; i < rollCount; ++i) {
+        if (!lootTables.Roll(TREASURE_TABLE, quality, gen, items)) {
+            // No loot tables loaded; a purse of gold scaled by quality
+            items.push_back({GOLD_ITEM, 5 * quality + quality * quality});
+        }
     }
     
-    // Add some randomness to the value
-    std::uniform_int_distribution<> valueMod(-level, level * 2);
-    int finalValue = std::max(1, baseValue + valueMod(gen));
-    
-    return TreasureItem(idSs.str(), name, description, finalValue);
+    std::cout << "Generated " << items.size() << " treasure items for encounter: " << name << std::endl;
 }
 
 } // namespace Game 
\ No newline at end of file
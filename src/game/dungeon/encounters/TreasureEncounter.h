@@ -1,24 +1,16 @@
 #pragma once
 
 #include "Encounter.h"
+#include "../../../data/LootTables.h"
 #include <vector>
-#include <string>
+#include <random>
 
 namespace Game {
 
 /**
- * Item in a treasure encounter
+ * Item in a treasure encounter: an items.json content ID and a count
  */
-struct TreasureItem {
-    std::string id;
-    std::string name;
-    std::string description;
-    int value;
-    
-    TreasureItem(const std::string& id, const std::string& name, 
-                const std::string& description, int value)
-        : id(id), name(name), description(description), value(value) {}
-};
+using TreasureItem = LootDrop;
 
 /**
  * Treasure encounter with items/rewards
@@ -49,9 +41,6 @@ private:
     std::vector<TreasureItem> items;
     bool isActive;
     float timeElapsed;
-    
-    // Treasure generation helper
-    TreasureItem CreateRandomTreasure(int level);
 };
 
 } // namespace Game 
\ No newline at end of file
@@ -1,16 +1,17 @@
 #include "Entity.h"
+#include "../combat/CombatLog.h"
 #include <iostream>
 
 namespace Game {
 
 Entity::Entity(const std::string& name) : name(name), isActive(true) {
-    std::cout << "Entity created: " << name << std::endl;
+    CombatLog::Out() << "Entity created: " << name << std::endl;
 }
 
 Entity::~Entity() {
     // Clean up all components
     components.clear();
-    std::cout << "Entity destroyed: " << name << std::endl;
+    CombatLog::Out() << "Entity destroyed: " << name << std::endl;
 }
 
 void Entity::Start() {
@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <typeindex>
+#include <stdexcept>
 #include "components/Component.h"
 
 namespace Game {
@@ -0,0 +1,156 @@
+#include "ActionSetComponent.h"
+#include "../../combat/CooldownTable.h"
+#include "../../combat/CombatLog.h"
+#include <iostream>
+
+namespace Game {
+
+int ActionSetComponent::AddAction(std::shared_ptr<const ActionRef> action) {
+    if (!action || !action->Get()) {
+        return -1;
+    }
+    
+    // A bound block has a fixed size, so rebind to grow it
+    CooldownTable* boundTable = table;
+    if (boundTable) {
+        UnbindCooldowns();
+    }
+    
+    actions.push_back(action);
+    cooldowns.push_back(0);
+    
+    if (boundTable) {
+        BindCooldowns(*boundTable);
+    }
+    
+    return static_cast<int>(actions.size()) - 1;
+}
+
+void ActionSetComponent::ClearActions() {
+    // Release the table block; slots are reclaimed when the table is cleared
+    table = nullptr;
+    tableBase = 0;
+    
+    actions.clear();
+    cooldowns.clear();
+}
+
+std::shared_ptr<const Action> ActionSetComponent::GetAction(size_t slot) const {
+    return (slot < actions.size()) ? actions[slot]->Get() : nullptr;
+}
+
+int ActionSetComponent::FindSlot(const Action* action) const {
+    if (!action) {
+        return -1;
+    }
+    for (size_t i = 0; i < actions.size(); ++i) {
+        if (actions[i]->Get()->GetKey() == action->GetKey()) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int ActionSetComponent::GetCooldown(size_t slot) const {
+    if (slot >= actions.size()) {
+        return 0;
+    }
+    return table ? table->Get(tableBase + slot) : cooldowns[slot];
+}
+
+void ActionSetComponent::StartCooldown(size_t slot) {
+    if (slot >= actions.size()) {
+        return;
+    }
+    
+    int value = actions[slot]->Get()->GetCooldown();
+    if (table) {
+        table->Set(tableBase + slot, value);
+    } else {
+        cooldowns[slot] = value;
+    }
+}
+
+void ActionSetComponent::TickCooldowns() {
+    for (size_t i = 0; i < actions.size(); ++i) {
+        int value = GetCooldown(i);
+        if (value <= 0) {
+            continue;
+        }
+        
+        if (table) {
+            table->Set(tableBase + i, value - 1);
+        } else {
+            cooldowns[i] = value - 1;
+        }
+    }
+}
+
+void ActionSetComponent::ResetCooldowns() {
+    for (size_t i = 0; i < actions.size(); ++i) {
+        if (table) {
+            table->Set(tableBase + i, 0);
+        } else {
+            cooldowns[i] = 0;
+        }
+    }
+}
+
+bool ActionSetComponent::CanUse(size_t slot, const Entity* target, const Battlefield* battlefield) const {
+    if (slot >= actions.size() || IsOnCooldown(slot)) {
+        return false;
+    }
+    return actions[slot]->Get()->CanUse(GetOwner(), target, battlefield);
+}
+
+ActionResult ActionSetComponent::Use(size_t slot, Entity* target, Battlefield* battlefield,
+                                     ResolutionEngine& resolution) {
+    if (slot >= actions.size()) {
+        return ActionResult::INVALID;
+    }
+    
+    // Hold the current definition for the whole use
+    std::shared_ptr<const Action> action = actions[slot]->Get();
+    
+    // Check if action is on cooldown
+    if (IsOnCooldown(slot)) {
+        CombatLog::Out() << "Action " << action->GetName() << " is on cooldown: " 
+                         << GetCooldown(slot) << " rounds remaining." << std::endl;
+        return ActionResult::INVALID;
+    }
+    
+    // Misses still consume the action
+    ActionResult result = action->Execute(GetOwner(), target, battlefield, resolution);
+    if (result != ActionResult::INVALID) {
+        StartCooldown(slot);
+    }
+    
+    return result;
+}
+
+void ActionSetComponent::BindCooldowns(CooldownTable& newTable) {
+    if (table == &newTable) {
+        return;
+    }
+    UnbindCooldowns();
+    
+    tableBase = newTable.Allocate(actions.size());
+    for (size_t i = 0; i < actions.size(); ++i) {
+        newTable.Set(tableBase + i, cooldowns[i]);
+    }
+    table = &newTable;
+}
+
+void ActionSetComponent::UnbindCooldowns() {
+    if (!table) {
+        return;
+    }
+    
+    for (size_t i = 0; i < actions.size(); ++i) {
+        cooldowns[i] = table->Get(tableBase + i);
+    }
+    table = nullptr;
+    tableBase = 0;
+}
+
+} // namespace Game 
\ No newline at end of file
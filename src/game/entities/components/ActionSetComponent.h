@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Component.h"
+#include "../../combat/Action.h"
+#include <vector>
+#include <memory>
+
+namespace Game {
+
+// Forward declarations
+class Battlefield;
+class CooldownTable;
+class ResolutionEngine;
+
+// Component holding the actions an entity knows and its per-slot cooldowns.
+// Action definitions are shared and immutable, and each slot follows its
+// action's ActionRef so reloaded definitions apply at once; everything that
+// changes while an entity fights (currently just cooldowns) is stored here.
+class ActionSetComponent : public Component {
+public:
+    ActionSetComponent() = default;
+    ~ActionSetComponent() override = default;
+    
+    // Add an action and return its slot index
+    int AddAction(std::shared_ptr<const ActionRef> action);
+    
+    // Remove all actions
+    void ClearActions();
+    
+    // Get the known actions
+    const std::vector<std::shared_ptr<const ActionRef>>& GetActions() const { return actions; }
+    size_t GetActionCount() const { return actions.size(); }
+    std::shared_ptr<const Action> GetAction(size_t slot) const;
+    
+    // Find the slot holding an action's ID (-1 if not known). Matching by ID
+    // keeps a definition picked before a reload usable after it.
+    int FindSlot(const Action* action) const;
+    
+    // Cooldown queries (rounds remaining before the action can be used again)
+    int GetCooldown(size_t slot) const;
+    bool IsOnCooldown(size_t slot) const { return GetCooldown(slot) > 0; }
+    
+    // Put a slot on cooldown using its action's cooldown value
+    void StartCooldown(size_t slot);
+    
+    // Advance this entity's cooldowns by one round
+    void TickCooldowns();
+    
+    // Clear all cooldowns
+    void ResetCooldowns();
+    
+    // Check if the action in a slot can be used on the target right now
+    bool CanUse(size_t slot, const Entity* target, const Battlefield* battlefield) const;
+    
+    // Use the action in a slot, starting its cooldown if it was attempted
+    ActionResult Use(size_t slot, Entity* target, Battlefield* battlefield, ResolutionEngine& resolution);
+    
+    // Move cooldowns into a shared table so a whole encounter ticks in one pass
+    void BindCooldowns(CooldownTable& table);
+    
+    // Copy cooldowns back out of the shared table
+    void UnbindCooldowns();
+    
+    // Check if cooldowns currently live in a shared table
+    bool IsBound() const { return table != nullptr; }
+    bool IsBoundTo(const CooldownTable& other) const { return table == &other; }
+    
+private:
+    // Known actions, indexed by slot
+    std::vector<std::shared_ptr<const ActionRef>> actions;
+    
+    // Cooldowns used while not bound to a table (parallel to actions)
+    std::vector<int> cooldowns;
+    
+    // Shared table and the start of this entity's block while bound
+    CooldownTable* table = nullptr;
+    size_t tableBase = 0;
+};
+
+} // namespace Game 
\ No newline at end of file
@@ -1,11 +1,20 @@
 #include "StatsComponent.h"
+#include "../../combat/CombatLog.h"
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 
 namespace Game {
 
-StatsComponent::StatsComponent() : maxHealth(0), currentHealth(0) {
+namespace {
+
+// Shared by all components so versions are never reused
+std::atomic<uint64_t> nextStatsVersion{1};
+
+} // namespace
+
+StatsComponent::StatsComponent() : maxHealth(0), currentHealth(0), version(nextStatsVersion++) {
     // Initialize all stats to 0
     baseStats[StatType::STRENGTH] = 0;
     baseStats[StatType::INTELLECT] = 0;
@@ -137,10 +146,14 @@ bool StatsComponent::TakeDamage(int damage) {
     
     // Check for block (completely negates damage)
     if (rand() % 100 < blockChance) {
-        std::cout << "Attack blocked!" << std::endl;
+        CombatLog::Out() << "Attack blocked!" << std::endl;
         return false;  // Not dead
     }
     
+    return ApplyDamage(damage);
+}
+
+bool StatsComponent::ApplyDamage(int damage) {
     // Apply damage
     currentHealth = std::max(0, currentHealth - damage);
     
@@ -149,6 +162,9 @@ bool StatsComponent::TakeDamage(int damage) {
 }
 
 void StatsComponent::RecalculateDerivedStats() {
+    // Any stat change invalidates tables built from the old values
+    version = nextStatsVersion++;
+    
     int oldMaxHealth = maxHealth;
     maxHealth = CalculateMaxHealth();
     
@@ -164,16 +180,21 @@ void StatsComponent::RecalculateDerivedStats() {
     }
 }
 
-std::string StatsComponent::GetStatName(StatType type) {
+const std::string& StatsComponent::GetStatName(StatType type) {
+    // Built once; callers get a reference instead of a new string per call
+    static const std::string NAMES[] = {
+        "Strength", "Intellect", "Speed", "Dexterity", "Constitution", "Defense", "Luck", "Unknown"
+    };
+    
     switch (type) {
-        case StatType::STRENGTH:     return "Strength";
-        case StatType::INTELLECT:    return "Intellect";
-        case StatType::SPEED:        return "Speed";
-        case StatType::DEXTERITY:    return "Dexterity";
-        case StatType::CONSTITUTION: return "Constitution";
-        case StatType::DEFENSE:      return "Defense";
-        case StatType::LUCK:         return "Luck";
-        default:                     return "Unknown";
+        case StatType::STRENGTH:     return NAMES[0];
+        case StatType::INTELLECT:    return NAMES[1];
+        case StatType::SPEED:        return NAMES[2];
+        case StatType::DEXTERITY:    return NAMES[3];
+        case StatType::CONSTITUTION: return NAMES[4];
+        case StatType::DEFENSE:      return NAMES[5];
+        case StatType::LUCK:         return NAMES[6];
+        default:                     return NAMES[7];
     }
 }
 
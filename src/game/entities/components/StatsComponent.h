@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Component.h"
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -61,10 +62,15 @@ public:
     void SetCurrentHealth(int health) { currentHealth = std::min(health, maxHealth); }
     void Heal(int amount) { currentHealth = std::min(currentHealth + amount, maxHealth); }
     bool TakeDamage(int damage);  // Returns true if entity dies
+    bool ApplyDamage(int damage); // Damage that was already resolved (no block roll)
     bool IsDead() const { return currentHealth <= 0; }
     
     // Return stat name as string
-    static std::string GetStatName(StatType type);
+    static const std::string& GetStatName(StatType type);
+    
+    // Changes whenever current stats change; unique across all components so
+    // caches keyed on it never confuse two entities
+    uint64_t GetVersion() const { return version; }
     
 private:
     // Base stat values
@@ -77,6 +83,9 @@ private:
     int maxHealth;
     int currentHealth;
     
+    // Stats version (see GetVersion)
+    uint64_t version;
+    
     // Recalculate derived stats based on current stats
     void RecalculateDerivedStats();
 };
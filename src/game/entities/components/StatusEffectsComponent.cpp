@@ -1,4 +1,5 @@
 #include "StatusEffectsComponent.h"
+#include "../../combat/CombatLog.h"
 #include <iostream>
 #include <algorithm>
 
@@ -7,7 +8,7 @@ namespace Game {
 //--------- StatusEffect Base Implementation ---------//
 
 StatusEffect::StatusEffect(StatusEffectType type, int duration, const std::string& name)
-    : type(type), duration(duration), name(name) {
+    : type(type), duration(duration), name(Engine::StringInterner::GetInstance().Intern(name)) {
 }
 
 bool StatusEffect::OnNewTurn(Entity* entity) {
@@ -27,34 +28,42 @@ void StatusEffectsComponent::AddEffect(std::unique_ptr<StatusEffect> effect) {
     // Check if an effect of the same name already exists
     auto it = std::find_if(activeEffects.begin(), activeEffects.end(),
         [&](const std::unique_ptr<StatusEffect>& existingEffect) {
-            return existingEffect->GetName() == effect->GetName();
+            return existingEffect->GetNameId() == effect->GetNameId();
         });
     
     if (it != activeEffects.end()) {
         // Replace the existing effect
         *it = std::move(effect);
-        std::cout << "Status effect " << (*it)->GetName() << " refreshed." << std::endl;
+        CombatLog::Out() << "Status effect " << (*it)->GetName() << " refreshed." << std::endl;
     } else {
         // Add the new effect
-        std::cout << "Status effect " << effect->GetName() << " applied." << std::endl;
+        CombatLog::Out() << "Status effect " << effect->GetName() << " applied." << std::endl;
         activeEffects.push_back(std::move(effect));
     }
 }
 
-void StatusEffectsComponent::RemoveEffect(const std::string& effectName) {
+void StatusEffectsComponent::RemoveEffect(std::string_view effectName) {
+    // A name that was never interned cannot belong to an active effect
+    Engine::StringId id;
+    if (Engine::StringInterner::GetInstance().Find(effectName, id)) {
+        RemoveEffect(id);
+    }
+}
+
+void StatusEffectsComponent::RemoveEffect(Engine::StringId effectName) {
     auto it = std::remove_if(activeEffects.begin(), activeEffects.end(),
         [&](const std::unique_ptr<StatusEffect>& effect) {
-            return effect->GetName() == effectName;
+            return effect->GetNameId() == effectName;
         });
     
     if (it != activeEffects.end()) {
-        std::cout << "Status effect " << effectName << " removed." << std::endl;
+        CombatLog::Out() << "Status effect " << Engine::StringInterner::GetInstance().Get(effectName) << " removed." << std::endl;
         activeEffects.erase(it, activeEffects.end());
     }
 }
 
 void StatusEffectsComponent::ClearEffects() {
-    std::cout << "All status effects cleared." << std::endl;
+    CombatLog::Out() << "All status effects cleared." << std::endl;
     activeEffects.clear();
 }
 
@@ -69,17 +78,22 @@ bool StatusEffectsComponent::HasEffect(StatusEffectType type) const {
         });
 }
 
-bool StatusEffectsComponent::HasEffectByName(const std::string& effectName) const {
+bool StatusEffectsComponent::HasEffectByName(std::string_view effectName) const {
+    Engine::StringId id;
+    return Engine::StringInterner::GetInstance().Find(effectName, id) && HasEffectByName(id);
+}
+
+bool StatusEffectsComponent::HasEffectByName(Engine::StringId effectName) const {
     return std::any_of(activeEffects.begin(), activeEffects.end(),
         [&](const std::unique_ptr<StatusEffect>& effect) {
-            return effect->GetName() == effectName;
+            return effect->GetNameId() == effectName;
         });
 }
 
 void StatusEffectsComponent::ProcessTurnStart() {
     if (activeEffects.empty()) return;
     
-    std::cout << "Processing " << activeEffects.size() << " status effects at turn start..." << std::endl;
+    CombatLog::Out() << "Processing " << activeEffects.size() << " status effects at turn start..." << std::endl;
     
     // Apply start-of-turn effects
     for (auto& effect : activeEffects) {
@@ -93,7 +107,7 @@ void StatusEffectsComponent::ProcessTurnStart() {
 void StatusEffectsComponent::ProcessTurnEnd() {
     if (activeEffects.empty()) return;
     
-    std::cout << "Processing " << activeEffects.size() << " status effects at turn end..." << std::endl;
+    CombatLog::Out() << "Processing " << activeEffects.size() << " status effects at turn end..." << std::endl;
     
     // Apply end-of-turn effects
     for (auto& effect : activeEffects) {
@@ -110,8 +124,8 @@ bool StatusEffectsComponent::ProcessNewTurn() {
     // Check if any effect prevents taking a turn
     for (auto& effect : activeEffects) {
         if (!effect->OnNewTurn(owner)) {
-            std::cout << owner->GetName() << " cannot take a turn due to " 
-                      << effect->GetName() << "!" << std::endl;
+            CombatLog::Out() << owner->GetName() << " cannot take a turn due to " 
+                             << effect->GetName() << "!" << std::endl;
             return false;
         }
     }
@@ -132,7 +146,7 @@ void StatusEffectsComponent::RemoveExpiredEffects() {
     auto it = std::remove_if(activeEffects.begin(), activeEffects.end(),
         [](const std::unique_ptr<StatusEffect>& effect) {
             if (effect->HasExpired()) {
-                std::cout << "Status effect " << effect->GetName() << " expired." << std::endl;
+                CombatLog::Out() << "Status effect " << effect->GetName() << " expired." << std::endl;
                 return true;
             }
             return false;
@@ -155,8 +169,8 @@ void PoisonEffect::OnTurnStart(Entity* entity) {
     // Apply poison damage at the start of turn
     auto& stats = entity->GetComponent<StatsComponent>();
     
-    std::cout << entity->GetName() << " takes " << damagePerTurn 
-              << " poison damage!" << std::endl;
+    CombatLog::Out() << entity->GetName() << " takes " << damagePerTurn 
+                     << " poison damage!" << std::endl;
     
     // Apply damage without killing the entity (minimum 1 HP left)
     int currentHealth = stats.GetCurrentHealth();
@@ -165,7 +179,7 @@ void PoisonEffect::OnTurnStart(Entity* entity) {
     if (damage > 0) {
         stats.TakeDamage(damage);
     } else {
-        std::cout << "Poison damage prevented to avoid death." << std::endl;
+        CombatLog::Out() << "Poison damage prevented to avoid death." << std::endl;
     }
 }
 
@@ -184,7 +198,7 @@ StunEffect::StunEffect(int duration)
 void StunEffect::OnTurnStart(Entity* entity) {
     if (!entity) return;
     
-    std::cout << entity->GetName() << " is stunned!" << std::endl;
+    CombatLog::Out() << entity->GetName() << " is stunned!" << std::endl;
 }
 
 void StunEffect::OnTurnEnd(Entity* entity) {
@@ -208,19 +222,9 @@ StatBuffEffect::StatBuffEffect(int duration, StatType statType, int modifierValu
       applied(false) {
     
     // Create descriptive name based on the stat and effect
-    std::string statName;
-    switch (statType) {
-        case StatType::STRENGTH: statName = "Strength"; break;
-        case StatType::INTELLECT: statName = "Intellect"; break;
-        case StatType::SPEED: statName = "Speed"; break;
-        case StatType::DEXTERITY: statName = "Dexterity"; break;
-        case StatType::CONSTITUTION: statName = "Constitution"; break;
-        case StatType::DEFENSE: statName = "Defense"; break;
-        case StatType::LUCK: statName = "Luck"; break;
-        default: statName = "Unknown"; break;
-    }
-    
-    name = (modifierValue > 0 ? "+" : "") + std::to_string(modifierValue) + " " + statName;
+    const std::string& statName = StatsComponent::GetStatName(statType);
+    name = Engine::StringInterner::GetInstance().Intern(
+        (modifierValue > 0 ? "+" : "") + std::to_string(modifierValue) + " " + statName);
     description = "Modifies " + statName + " by " + std::to_string(modifierValue) + 
                   " for " + std::to_string(duration) + " turns.";
 }
@@ -234,7 +238,7 @@ void StatBuffEffect::OnTurnStart(Entity* entity) {
         stats.AddModifier(statType, modifierValue, duration);
         applied = true;
         
-        std::cout << entity->GetName() << "'s " << description << std::endl;
+        CombatLog::Out() << entity->GetName() << "'s " << description << std::endl;
     }
 }
 
@@ -3,9 +3,11 @@
 #include "Component.h"
 #include "StatsComponent.h"
 #include "../Entity.h"
+#include "../../../engine/core/StringInterner.h"
 #include <vector>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <functional>
 
 namespace Game {
@@ -45,7 +47,8 @@ public:
     // Getters for basic properties
     StatusEffectType GetType() const { return type; }
     int GetDuration() const { return duration; }
-    std::string GetName() const { return name; }
+    const std::string& GetName() const { return Engine::StringInterner::GetInstance().Get(name); }
+    Engine::StringId GetNameId() const { return name; }
     std::string GetDescription() const { return description; }
     
     // Check if effect has expired
@@ -57,7 +60,7 @@ public:
 protected:
     StatusEffectType type;
     int duration;
-    std::string name;
+    Engine::StringId name;      // Interned; effects are matched by name
     std::string description;
     
     // Reduce the duration by 1
@@ -73,7 +76,8 @@ public:
     void AddEffect(std::unique_ptr<StatusEffect> effect);
     
     // Remove a status effect by name
-    void RemoveEffect(const std::string& effectName);
+    void RemoveEffect(std::string_view effectName);
+    void RemoveEffect(Engine::StringId effectName);
     
     // Clear all status effects
     void ClearEffects();
@@ -83,7 +87,8 @@ public:
     
     // Check if entity has a specific effect
     bool HasEffect(StatusEffectType type) const;
-    bool HasEffectByName(const std::string& effectName) const;
+    bool HasEffectByName(std::string_view effectName) const;
+    bool HasEffectByName(Engine::StringId effectName) const;
     
     // Process effects at turn start
     void ProcessTurnStart();
@@ -1,8 +1,12 @@
 #include "ActionTestState.h"
 #include "../../engine/input/InputHandler.h"
 #include "../../data/ActionDataLoader.h"
+#include "../../engine/core/Application.h"
+#include "../../data/ContentPipeline.h"
 #include "../entities/components/PositionComponent.h"
 #include "../entities/components/StatsComponent.h"
+#include "../entities/components/ActionSetComponent.h"
+#include <chrono>
 #include <iostream>
 #include <algorithm>
 
@@ -23,8 +27,9 @@ ActionTestState::~ActionTestState() {
 void ActionTestState::Enter() {
     std::cout << "Entering Action Test State" << std::endl;
     
-    // Load actions from JSON
+    // Load actions and pick up edits to them while the state runs
     LoadActions();
+    WatchActions();
     
     // Create entities and set up battlefield
     CreateEntities();
@@ -40,6 +45,9 @@ void ActionTestState::Enter() {
 void ActionTestState::Exit() {
     std::cout << "Exiting Action Test State" << std::endl;
     
+    Engine::Application::GetInstance().GetFileWatcher().Unwatch(actionsWatch);
+    actionsWatch = -1;
+    
     // Clear entities and battlefield
     player.reset();
     enemy.reset();
@@ -198,6 +206,12 @@ void ActionTestState::CreateEntities() {
     auto& playerStats = player->AddComponent<StatsComponent>();
     playerStats.Initialize(15, 10, 12, 10, 20, 8, 5);
     
+    // Add action set component with the player's loadout
+    auto& playerActionSet = player->AddComponent<ActionSetComponent>();
+    for (const auto& action : playerActions) {
+        playerActionSet.AddAction(action);
+    }
+    
     // Add to battlefield
     battlefield.PlaceEntity(player, 3);
     
@@ -212,17 +226,48 @@ void ActionTestState::CreateEntities() {
     auto& enemyStats = enemy->AddComponent<StatsComponent>();
     enemyStats.Initialize(12, 8, 10, 8, 15, 5, 3);
     
+    // Add action set component with the enemy's loadout
+    auto& enemyActionSet = enemy->AddComponent<ActionSetComponent>();
+    for (const auto& action : enemyActions) {
+        enemyActionSet.AddAction(action);
+    }
+    
     // Add to battlefield
     battlefield.PlaceEntity(enemy, 5);
 }
 
+void ActionTestState::WatchActions() {
+    // Re-read actions.json whenever it is saved; changed definitions are
+    // swapped in behind each action ID, so the current fight uses the new
+    // numbers at once
+    actionsWatch = Engine::Application::GetInstance().GetFileWatcher().Watch(
+        "src/data/schemas/actions.json", [](const std::string& path) {
+            auto start = std::chrono::steady_clock::now();
+            ContentReloadSummary summary;
+            if (!ActionDataLoader::GetInstance().ReloadActions(path, summary)) {
+                std::cerr << "Keeping previous actions; fix " << path << " and save again" << std::endl;
+                return;
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "Reloaded " << path << ": " << summary.changed << " changed, " << summary.added
+                      << " added, " << summary.removed << " removed (" << ms << " ms)" << std::endl;
+        });
+}
+
 void ActionTestState::LoadActions() {
-    // Load actions from JSON file
+    // Actions are preloaded by the startup content pipeline; only load
+    // them here (pack first, then JSON) if that failed
     ActionDataLoader& loader = ActionDataLoader::GetInstance();
-    bool success = loader.LoadActions("src/data/schemas/actions.json");
+    bool success = ContentPipeline::GetInstance().WaitUntilReady();
+    if (!success) {
+        ContentPack pack;
+        success = pack.Open(ContentPack::DEFAULT_PATH)
+            ? loader.LoadActions(pack)
+            : loader.LoadActions("src/data/schemas/actions.json");
+    }
     
     if (!success) {
-        std::cerr << "Failed to load actions from JSON" << std::endl;
+        std::cerr << "Failed to load actions" << std::endl;
         return;
     }
     
@@ -234,24 +279,24 @@ void ActionTestState::LoadActions() {
     enemyActions.clear();
     
     // Assign specific actions to player
-    playerActions.push_back(loader.GetAction("slash"));
-    playerActions.push_back(loader.GetAction("fireball"));
-    playerActions.push_back(loader.GetAction("heal"));
-    playerActions.push_back(loader.GetAction("strength_buff"));
-    playerActions.push_back(loader.GetAction("advance"));
-    playerActions.push_back(loader.GetAction("retreat"));
+    playerActions.push_back(loader.GetActionRef("slash"));
+    playerActions.push_back(loader.GetActionRef("fireball"));
+    playerActions.push_back(loader.GetActionRef("heal"));
+    playerActions.push_back(loader.GetActionRef("strength_buff"));
+    playerActions.push_back(loader.GetActionRef("advance"));
+    playerActions.push_back(loader.GetActionRef("retreat"));
     
     // Add compound actions
-    playerActions.push_back(loader.GetAction("charge"));
-    playerActions.push_back(loader.GetAction("power_strike"));
-    playerActions.push_back(loader.GetAction("life_drain"));
+    playerActions.push_back(loader.GetActionRef("charge"));
+    playerActions.push_back(loader.GetActionRef("power_strike"));
+    playerActions.push_back(loader.GetActionRef("life_drain"));
     
     // Assign specific actions to enemy
-    enemyActions.push_back(loader.GetAction("slash"));
-    enemyActions.push_back(loader.GetAction("quick_stab"));
-    enemyActions.push_back(loader.GetAction("weaken"));
-    enemyActions.push_back(loader.GetAction("advance"));
-    enemyActions.push_back(loader.GetAction("stun_slash"));
+    enemyActions.push_back(loader.GetActionRef("slash"));
+    enemyActions.push_back(loader.GetActionRef("quick_stab"));
+    enemyActions.push_back(loader.GetActionRef("weaken"));
+    enemyActions.push_back(loader.GetActionRef("advance"));
+    enemyActions.push_back(loader.GetActionRef("stun_slash"));
 }
 
 void ActionTestState::ExecuteSelectedAction() {
@@ -260,34 +305,28 @@ void ActionTestState::ExecuteSelectedAction() {
         return;
     }
     
-    // Get the selected action
-    std::shared_ptr<Action> action = playerActions[selectedActionIndex];
+    // Get the selected action (slots match the loadout order)
+    auto& actionSet = player->GetComponent<ActionSetComponent>();
+    std::shared_ptr<const Action> action = actionSet.GetAction(selectedActionIndex);
     
     // Determine the correct target based on action type
     Entity* target = enemy.get(); // Default target is enemy
     
     // For movement and self-targeted actions, target the player instead
     if (action->GetType() == ActionType::MOVEMENT || 
-        action->GetProperty("self_only") > 0) {
+        action->IsSelfOnly()) {
         target = player.get();
     }
     
     // Check if action can be used
-    if (!action->CanUse(player.get(), target, &battlefield)) {
+    if (!actionSet.CanUse(selectedActionIndex, target, &battlefield)) {
         // Cannot use action - show message but stay in SELECT_ACTION state
         std::cout << "Cannot use action: " << action->GetName() << std::endl;
         return;
     }
     
-    // Execute the action
-    bool success = action->Execute(player.get(), target, &battlefield);
-    
-    // Update cooldowns on all actions
-    for (auto& act : playerActions) {
-        if (act != action && act->IsOnCooldown()) {
-            act->DecreaseCooldown();
-        }
-    }
+    // Execute the action (starts its cooldown)
+    actionSet.Use(selectedActionIndex, target, &battlefield, resolution);
     
     // Switch to enemy turn
     currentState = UIState::WAITING;
@@ -298,54 +337,53 @@ void ActionTestState::ExecuteEnemyTurn() {
     // Implement simple AI for enemy
     // For now, just select a random valid action
     
-    // Filter available actions (not on cooldown and can be used)
-    std::vector<std::shared_ptr<Action>> validActions;
+    // Filter available action slots (not on cooldown and can be used)
+    auto& actionSet = enemy->GetComponent<ActionSetComponent>();
+    std::vector<size_t> validSlots;
     
-    for (auto& action : enemyActions) {
+    for (size_t slot = 0; slot < actionSet.GetActionCount(); ++slot) {
+        auto action = actionSet.GetAction(slot);
+        
         // Determine the correct target based on action type
         Entity* target = player.get(); // Default target is player
         
         // For movement and self-targeted actions, target the enemy itself
         if (action->GetType() == ActionType::MOVEMENT || 
-            action->GetProperty("self_only") > 0) {
+            action->IsSelfOnly()) {
             target = enemy.get();
         }
         
-        if (!action->IsOnCooldown() && action->CanUse(enemy.get(), target, &battlefield)) {
-            // Store the action along with its target
-            validActions.push_back(action);
+        if (actionSet.CanUse(slot, target, &battlefield)) {
+            validSlots.push_back(slot);
         }
     }
     
-    if (!validActions.empty()) {
+    if (!validSlots.empty()) {
         // Select random action
-        int index = std::rand() % validActions.size();
-        std::shared_ptr<Action> selectedAction = validActions[index];
+        size_t slot = validSlots[std::rand() % validSlots.size()];
+        std::shared_ptr<const Action> selectedAction = actionSet.GetAction(slot);
         
         // Determine the correct target for the selected action
         Entity* target = player.get(); // Default target is player
         
         // For movement and self-targeted actions, target the enemy itself
         if (selectedAction->GetType() == ActionType::MOVEMENT || 
-            selectedAction->GetProperty("self_only") > 0) {
+            selectedAction->IsSelfOnly()) {
             target = enemy.get();
         }
         
         // Execute action
         std::cout << "Enemy uses " << selectedAction->GetName() << std::endl;
-        selectedAction->Execute(enemy.get(), target, &battlefield);
-        
-        // Update cooldowns on all actions
-        for (auto& act : enemyActions) {
-            if (act != selectedAction && act->IsOnCooldown()) {
-                act->DecreaseCooldown();
-            }
-        }
+        actionSet.Use(slot, target, &battlefield, resolution);
     }
     else {
         std::cout << "Enemy has no valid actions" << std::endl;
     }
     
+    // Both sides have acted, so the round is over
+    player->GetComponent<ActionSetComponent>().TickCooldowns();
+    actionSet.TickCooldowns();
+    
     // Switch back to player turn
     currentState = UIState::SELECT_ACTION;
     playerTurn = true;
@@ -493,8 +531,9 @@ void ActionTestState::DrawActionList() {
     int actionY = y + 40;
     int lineHeight = 30;
     
-    for (size_t i = 0; i < playerActions.size(); i++) {
-        auto& action = playerActions[i];
+    const auto& actionSet = player->GetComponent<ActionSetComponent>();
+    for (size_t i = 0; i < actionSet.GetActionCount(); i++) {
+        auto action = actionSet.GetAction(i);
         
         // Background for selected action
         if (static_cast<int>(i) == selectedActionIndex && currentState == UIState::SELECT_ACTION && playerTurn) {
@@ -510,8 +549,8 @@ void ActionTestState::DrawActionList() {
         std::string actionText = action->GetName();
         
         // Show cooldown if on cooldown
-        if (action->IsOnCooldown()) {
-            actionText += " (CD: " + std::to_string(action->GetCurrentCooldown()) + ")";
+        if (actionSet.IsOnCooldown(i)) {
+            actionText += " (CD: " + std::to_string(actionSet.GetCooldown(i)) + ")";
             textColor = DARKGRAY; // Dimmed text for actions on cooldown
         }
         
@@ -4,6 +4,7 @@
 #include "../../engine/rendering/Renderer.h"
 #include "../combat/Battlefield.h"
 #include "../combat/Action.h"
+#include "../combat/ResolutionEngine.h"
 #include "../entities/Entity.h"
 #include <memory>
 #include <vector>
@@ -31,13 +32,17 @@ private:
     // Battlefield instance
     Battlefield battlefield;
     
+    // Dice and outcome tables for the test fights
+    ResolutionEngine resolution;
+    
     // Player and enemy entities
     std::shared_ptr<Entity> player;
     std::shared_ptr<Entity> enemy;
     
-    // Available actions
-    std::vector<std::shared_ptr<Action>> playerActions;
-    std::vector<std::shared_ptr<Action>> enemyActions;
+    // Action loadouts (shared definitions; cooldowns live in each entity's ActionSetComponent)
+    std::vector<std::shared_ptr<const ActionRef>> playerActions;
+    std::vector<std::shared_ptr<const ActionRef>> enemyActions;
+    int actionsWatch = -1;          // FileWatcher id for actions.json
     
     // Selected action index
     int selectedActionIndex;
@@ -62,6 +67,9 @@ private:
     // Load actions from JSON
     void LoadActions();
     
+    // Hot-reload actions.json while the state runs
+    void WatchActions();
+    
     // Handle player action selection
     void SelectAction(int index);
     
@@ -1,6 +1,9 @@
 #include "CombatTestState.h"
 #include "../../engine/rendering/Renderer.h"
 #include "../../engine/input/InputHandler.h"
+#include "../../engine/core/Application.h"
+#include "../../data/ContentPipeline.h"
+#include <chrono>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -28,8 +31,9 @@ void CombatTestState::Enter() {
     CreatePlayer();
     CreateEnemies();
     
-    // Load actions
+    // Load actions and pick up edits to them while the battle runs
     LoadActions();
+    WatchActions();
     
     // Start combat
     StartCombat();
@@ -38,6 +42,9 @@ void CombatTestState::Enter() {
 void CombatTestState::Exit() {
     std::cout << "Exiting Combat Test State" << std::endl;
     
+    Engine::Application::GetInstance().GetFileWatcher().Unwatch(actionsWatch);
+    actionsWatch = -1;
+    
     // Clear teams
     playerTeam.clear();
     enemyTeam.clear();
@@ -103,11 +110,18 @@ void CombatTestState::CreateEnemies() {
 }
 
 void CombatTestState::LoadActions() {
-    // Load actions from JSON file
-    bool success = actionLoader.LoadActions("src/data/schemas/actions.json");
+    // Actions are preloaded by the startup content pipeline; only load
+    // them here (pack first, then JSON) if that failed
+    bool success = ContentPipeline::GetInstance().WaitUntilReady();
+    if (!success) {
+        ContentPack pack;
+        success = pack.Open(ContentPack::DEFAULT_PATH)
+            ? actionLoader.LoadActions(pack)
+            : actionLoader.LoadActions("src/data/schemas/actions.json");
+    }
     
     if (!success) {
-        std::cerr << "Failed to load actions from JSON" << std::endl;
+        std::cerr << "Failed to load actions" << std::endl;
         return;
     }
     
@@ -115,18 +129,44 @@ void CombatTestState::LoadActions() {
     playerActions.clear();
     
     // Assign specific actions to player
-    playerActions.push_back(actionLoader.GetAction("slash"));
-    playerActions.push_back(actionLoader.GetAction("fireball"));
-    playerActions.push_back(actionLoader.GetAction("heal"));
-    playerActions.push_back(actionLoader.GetAction("strength_buff"));
-    playerActions.push_back(actionLoader.GetAction("advance"));
-    playerActions.push_back(actionLoader.GetAction("retreat"));
-    playerActions.push_back(actionLoader.GetAction("power_strike"));
-    playerActions.push_back(actionLoader.GetAction("stun_slash"));
+    playerActions.push_back(actionLoader.GetActionRef("slash"));
+    playerActions.push_back(actionLoader.GetActionRef("fireball"));
+    playerActions.push_back(actionLoader.GetActionRef("heal"));
+    playerActions.push_back(actionLoader.GetActionRef("strength_buff"));
+    playerActions.push_back(actionLoader.GetActionRef("advance"));
+    playerActions.push_back(actionLoader.GetActionRef("retreat"));
+    playerActions.push_back(actionLoader.GetActionRef("power_strike"));
+    playerActions.push_back(actionLoader.GetActionRef("stun_slash"));
+    playerActions.push_back(actionLoader.GetActionRef("cleave"));
+    playerActions.push_back(actionLoader.GetActionRef("chain_lightning"));
+    
+    // Give the player an action set so cooldowns are tracked per entity
+    auto& actionSet = player->AddComponent<ActionSetComponent>();
+    for (const auto& action : playerActions) {
+        actionSet.AddAction(action);
+    }
     
     std::cout << "Loaded " << playerActions.size() << " actions for player" << std::endl;
 }
 
+void CombatTestState::WatchActions() {
+    // Re-read actions.json whenever it is saved; changed definitions are
+    // swapped in behind each action ID, so the current battle uses the new
+    // numbers at once
+    actionsWatch = Engine::Application::GetInstance().GetFileWatcher().Watch(
+        "src/data/schemas/actions.json", [](const std::string& path) {
+            auto start = std::chrono::steady_clock::now();
+            ContentReloadSummary summary;
+            if (!ActionDataLoader::GetInstance().ReloadActions(path, summary)) {
+                std::cerr << "Keeping previous actions; fix " << path << " and save again" << std::endl;
+                return;
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "Reloaded " << path << ": " << summary.changed << " changed, " << summary.added
+                      << " added, " << summary.removed << " removed (" << ms << " ms)" << std::endl;
+        });
+}
+
 void CombatTestState::StartCombat() {
     // Initialize the combat system
     combatSystem.StartCombat(playerTeam, enemyTeam);
@@ -208,7 +248,7 @@ void CombatTestState::HandleActionSelection() {
     // Select action
     if (input.IsActionJustPressed(Engine::InputAction::CONFIRM)) {
         if (selectedActionIndex >= 0 && selectedActionIndex < static_cast<int>(playerActions.size())) {
-            auto action = playerActions[selectedActionIndex];
+            auto action = playerActions[selectedActionIndex]->Get();
             
             // Check if it's a self-targeted action
             if (IsSelfTargetedAction(action.get())) {
@@ -229,7 +269,7 @@ void CombatTestState::HandleTargetSelection() {
     Engine::InputHandler& input = Engine::InputHandler::GetInstance();
     
     // Get valid targets for the selected action
-    auto action = playerActions[selectedActionIndex];
+    auto action = playerActions[selectedActionIndex]->Get();
     auto validTargets = combatSystem.GetValidTargets(action);
     
     if (validTargets.empty()) {
@@ -267,7 +307,7 @@ void CombatTestState::HandleTargetSelection() {
 
 void CombatTestState::ExecuteSelectedAction() {
     // Get the selected action and target
-    auto action = playerActions[selectedActionIndex];
+    auto action = playerActions[selectedActionIndex]->Get();
     
     // If it's a self-targeted action, target is the player
     std::shared_ptr<Entity> target;
@@ -544,7 +584,7 @@ void CombatTestState::RenderActionMenu() {
     int menuX = 50;
     int menuY = 120;
     int menuWidth = 300;
-    int menuHeight = 250;
+    int menuHeight = 300;
     
     // Draw menu background
     renderer.DrawRect(menuX, menuY, menuWidth, menuHeight, LIGHTGRAY);
@@ -556,7 +596,7 @@ void CombatTestState::RenderActionMenu() {
     // Draw actions
     int y = menuY + 40;
     for (size_t i = 0; i < playerActions.size(); i++) {
-        auto action = playerActions[i];
+        auto action = playerActions[i]->Get();
         
         // Highlight selected action
         Engine::RColor color = (i == static_cast<size_t>(selectedActionIndex)) ? RED : BLACK;
@@ -584,13 +624,22 @@ void CombatTestState::RenderActionMenu() {
         
         if (action->GetType() == ActionType::ATTACK) {
             ss << "DMG: " << action->GetDamage();
+            if (action->IsMultiTarget()) {
+                ss << " AOE";
+            }
         } else if (action->GetType() == ActionType::HEAL) {
             ss << "HEAL: " << action->GetProperty("heal_amount");
         } else if (action->GetType() == ActionType::MOVEMENT) {
-            int moveAmount = action->GetProperty("position_change");
+            int moveAmount = action->GetPositionChange();
             ss << (moveAmount > 0 ? "FWD: " : "BWD: ") << std::abs(moveAmount);
         }
         
+        // Show remaining cooldown from the player's action set
+        const auto& actionSet = player->GetComponent<ActionSetComponent>();
+        if (actionSet.IsOnCooldown(i)) {
+            ss << " CD: " << actionSet.GetCooldown(i);
+        }
+        
         renderer.DrawText(ss.str().c_str(), menuX + 220, y, 14, color);
         
         y += 25;
@@ -601,7 +650,7 @@ void CombatTestState::RenderTargetSelection() {
     Engine::Renderer& renderer = Engine::Renderer::GetInstance();
     
     // Get the selected action
-    auto action = playerActions[selectedActionIndex];
+    auto action = playerActions[selectedActionIndex]->Get();
     
     // Get valid targets
     auto validTargets = combatSystem.GetValidTargets(action);
@@ -656,7 +705,17 @@ void CombatTestState::RenderTargetSelection() {
             renderer.DrawText(ss.str().c_str(), menuX + 220, y, 14, color);
         }
         
-        y += 25;
+        // Draw the exact expected damage (accuracy, crit and block included)
+        float expectedDamage = combatSystem.GetResolution().ExpectedDamage(
+            *action, combatSystem.GetCurrentEntity().get(), target.get());
+        if (expectedDamage > 0.0f) {
+            std::stringstream ss;
+            ss << "Exp. DMG: " << std::fixed << std::setprecision(1) << expectedDamage;
+            
+            renderer.DrawText(ss.str().c_str(), menuX + 20, y + 18, 12, color);
+        }
+        
+        y += 40;
     }
 }
 
@@ -811,7 +870,7 @@ bool CombatTestState::IsSelfTargetedAction(const Action* action) const {
     // Self-targeted actions are typically heals or buffs
     return (action->GetType() == ActionType::HEAL || 
             action->GetType() == ActionType::BUFF || 
-            action->GetProperty("self_only") > 0);
+            action->IsSelfOnly());
 }
 
 } // namespace Game 
\ No newline at end of file
@@ -4,10 +4,12 @@
 #include "../combat/Battlefield.h"
 #include "../combat/TurnManager.h"
 #include "../combat/CombatSystem.h"
+#include "../combat/ResolutionEngine.h"
 #include "../entities/Entity.h"
 #include "../entities/components/StatsComponent.h"
 #include "../entities/components/PositionComponent.h"
 #include "../entities/components/StatusEffectsComponent.h"
+#include "../entities/components/ActionSetComponent.h"
 #include "../../data/ActionDataLoader.h"
 #include <memory>
 #include <vector>
@@ -43,7 +45,8 @@ private:
     
     // Action data
     Game::ActionDataLoader& actionLoader = Game::ActionDataLoader::GetInstance();
-    std::vector<std::shared_ptr<Action>> playerActions;
+    std::vector<std::shared_ptr<const ActionRef>> playerActions;
+    int actionsWatch = -1;          // FileWatcher id for actions.json
     
     // UI state
     enum class CombatUIState {
@@ -72,6 +75,7 @@ private:
     void CreatePlayer();
     void CreateEnemies();
     void LoadActions();
+    void WatchActions();
     void StartCombat();
     void HandleActionSelection();
     void HandleTargetSelection();
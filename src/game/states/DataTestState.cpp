@@ -1,5 +1,9 @@
 #include "DataTestState.h"
 #include "../../engine/input/InputHandler.h"
+#include "../../engine/core/Application.h"
+#include "../../data/ContentPipeline.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 
 namespace Game {
@@ -28,10 +32,36 @@ void DataTestState::Enter() {
     
     // Initialize selected item
     selectedItem = 0;
+    
+    // Re-read items.json whenever it is saved; loaded items are patched
+    // in place and the list picks up added or removed entries
+    itemsWatch = Engine::Application::GetInstance().GetFileWatcher().Watch(
+        "src/data/schemas/items.json", [this](const std::string& path) {
+            auto start = std::chrono::steady_clock::now();
+            if (!itemLoader) {
+                // Nothing loaded at startup; the saved file may fix that
+                itemLoader = &localItems;
+            }
+            ContentReloadSummary summary;
+            if (!itemLoader->ReloadFromFile(path, summary)) {
+                std::cerr << "Keeping previous items; fix " << path << " and save again" << std::endl;
+                return;
+            }
+            
+            itemKeys = itemLoader->GetKeys();
+            selectedItem = std::min(selectedItem, std::max(0, static_cast<int>(itemKeys.size()) - 1));
+            
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "Reloaded " << path << ": " << summary.changed << " changed, " << summary.added
+                      << " added, " << summary.removed << " removed (" << ms << " ms)" << std::endl;
+        });
 }
 
 void DataTestState::Exit() {
     std::cout << "Exiting Data Test State" << std::endl;
+    
+    Engine::Application::GetInstance().GetFileWatcher().Unwatch(itemsWatch);
+    itemsWatch = -1;
 }
 
 void DataTestState::Update(float deltaTime) {
@@ -76,7 +106,7 @@ void DataTestState::Render() {
         int yPos = 130;
         for (size_t i = 0; i < itemKeys.size(); i++) {
             Engine::RColor color = (static_cast<int>(i) == selectedItem) ? RED : DARKGRAY;
-            renderer.DrawText(itemKeys[i].c_str(), 70, yPos, 16, color);
+            renderer.DrawText(Engine::StringInterner::GetInstance().Get(itemKeys[i]).c_str(), 70, yPos, 16, color);
             yPos += 30;
         }
         
@@ -114,7 +144,21 @@ void DataTestState::Resume() {
 }
 
 bool DataTestState::LoadItemData() {
-    // Try different paths
+    // Items are preloaded by the startup content pipeline (from the content
+    // pack when there is one); share its table
+    ContentPipeline& content = ContentPipeline::GetInstance();
+    if (content.WaitUntilReady()) {
+        itemLoader = &content.GetItems();
+        std::cout << "Using " << itemLoader->GetItemCount() << " preloaded items (content ready in "
+                  << content.GetLoadMilliseconds() << " ms)" << std::endl;
+        
+        itemKeys = itemLoader->GetKeys();
+        if (!itemKeys.empty()) {
+            return true;
+        }
+    }
+    
+    // Otherwise try the JSON source at different paths
     const std::string paths[] = {
         "src/data/schemas/items.json",
         "./src/data/schemas/items.json",
@@ -125,14 +169,18 @@ bool DataTestState::LoadItemData() {
     
     for (const auto& path : paths) {
         std::cout << "Trying to load from: " << path << std::endl;
-        if (itemLoader.LoadFromFile(path)) {
-            std::cout << "Successfully loaded from: " << path << std::endl;
+        if (localItems.LoadFromFile(path)) {
+            itemLoader = &localItems;
+            const ContentLoadStats& stats = itemLoader->GetLastLoadStats();
+            std::cout << "Successfully loaded from: " << path << " (" << stats.bytes << " bytes at "
+                      << stats.GetMegabytesPerSecond() << " MB/s)" << std::endl;
             
             // Get item keys
-            itemKeys.clear();
-            for (const auto& [key, item] : itemLoader.GetItems()) {
-                itemKeys.push_back(key);
-                std::cout << "Loaded item: " << key << " - " << item->GetName() << std::endl;
+            itemKeys = itemLoader->GetKeys();
+            const std::vector<ItemData>& items = itemLoader->GetItems();
+            for (size_t i = 0; i < items.size(); ++i) {
+                std::cout << "Loaded item: " << Engine::StringInterner::GetInstance().Get(itemKeys[i]) << " - "
+                          << items[i].GetName() << std::endl;
             }
             
             return !itemKeys.empty();
@@ -142,8 +190,8 @@ bool DataTestState::LoadItemData() {
     return false;
 }
 
-void DataTestState::RenderItemDetails(const std::string& key, int x, int y) {
-    auto item = itemLoader.GetItem(key);
+void DataTestState::RenderItemDetails(Engine::StringId key, int x, int y) {
+    const ItemData* item = itemLoader->GetItem(key);
     if (!item) return;
     
     Engine::Renderer& renderer = Engine::Renderer::GetInstance();
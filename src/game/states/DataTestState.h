@@ -25,17 +25,21 @@ public:
     std::string GetStateName() const override { return "DataTestState"; }
     
 private:
-    // Item data loader
-    ItemLoader itemLoader;
+    // Item table: the content pipeline's, or localItems if it failed to load
+    ItemLoader* itemLoader = nullptr;
+    ItemLoader localItems;
     
     // Selected item index
     int selectedItem = 0;
     
     // List of item keys for navigation
-    std::vector<std::string> itemKeys;
+    std::vector<Engine::StringId> itemKeys;
+    
+    // FileWatcher id for items.json
+    int itemsWatch = -1;
     
     // Display a specific item
-    void RenderItemDetails(const std::string& key, int x, int y);
+    void RenderItemDetails(Engine::StringId key, int x, int y);
     
     // Load item data
     bool LoadItemData();
@@ -2,14 +2,29 @@
 #include "../../engine/rendering/Renderer.h"
 #include "../../engine/input/InputHandler.h"
 #include "../dungeon/encounters/Encounter.h"
+#include "../dungeon/FloorSerializer.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <chrono>
 
 namespace Game {
 
+namespace {
+
+// Where the test state saves and restores floors
+const char* SAVE_FILE = "dungeon_floor.sav";
+
+// Floors of the current run beyond this budget are paged out to disk
+const char* FLOOR_CACHE_DIRECTORY = "floor_cache";
+const size_t FLOOR_CACHE_BUDGET = 64 * 1024 * 1024;
+
+} // namespace
+
 DungeonTestState::DungeonTestState()
-    : uiState(UIState::MAIN_MENU),
+    : floorNumber(1),
+      runSeed(0),
+      uiState(UIState::MAIN_MENU),
       selectedRoomIndex(0),
       selectedMenuOption(0),
       gridOffsetX(0),
@@ -18,6 +33,7 @@ DungeonTestState::DungeonTestState()
       showRoomIDs(true),
       showRoomTypes(true),
       showEncounters(true),
+      reuseSeed(false),
       isPaused(false) {
     
     // Set default generation parameters
@@ -38,7 +54,14 @@ void DungeonTestState::Enter() {
     std::cout << "Entering Dungeon Test State" << std::endl;
     
     // Clear any existing dungeon
-    currentDungeon.clear();
+    currentFloor.reset();
+    
+    // Build the next two floors in the background while this one is shown
+    preloader = std::make_unique<FloorPreloader>(
+        [this](int floor) { return GetParamsForFloor(floor); }, 2);
+    
+    // Floors already played stay available for going back up
+    floorCache = std::make_unique<FloorCache>(FLOOR_CACHE_DIRECTORY, FLOOR_CACHE_BUDGET);
     
     // Generate a dungeon with default parameters
     GenerateDungeon();
@@ -47,8 +70,10 @@ void DungeonTestState::Enter() {
 void DungeonTestState::Exit() {
     std::cout << "Exiting Dungeon Test State" << std::endl;
     
-    // Clear the dungeon
-    currentDungeon.clear();
+    // Stop background generation and clear the dungeon
+    preloader.reset();
+    floorCache.reset();
+    currentFloor.reset();
 }
 
 void DungeonTestState::Pause() {
@@ -127,10 +152,10 @@ void DungeonTestState::UpdateMainMenu() {
     
     // Handle menu navigation
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP)) {
-        selectedMenuOption = (selectedMenuOption - 1 + 3) % 3;
+        selectedMenuOption = (selectedMenuOption - 1 + 7) % 7;
     }
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_DOWN)) {
-        selectedMenuOption = (selectedMenuOption + 1) % 3;
+        selectedMenuOption = (selectedMenuOption + 1) % 7;
     }
     
     // Handle menu selection
@@ -140,11 +165,29 @@ void DungeonTestState::UpdateMainMenu() {
                 uiState = UIState::GENERATE_DUNGEON;
                 break;
             case 1: // View Dungeon
-                if (!currentDungeon.empty()) {
+                if (HasDungeon()) {
                     uiState = UIState::VIEW_DUNGEON;
                 }
                 break;
-            case 2: // Exit
+            case 2: // Descend
+                if (HasDungeon()) {
+                    DescendToNextFloor();
+                }
+                break;
+            case 3: // Ascend
+                if (HasDungeon()) {
+                    AscendToPreviousFloor();
+                }
+                break;
+            case 4: // Save
+                if (HasDungeon()) {
+                    SaveFloor();
+                }
+                break;
+            case 5: // Load
+                LoadFloor();
+                break;
+            case 6: // Exit
                 Engine::StateManager::GetInstance().PopState();
                 break;
         }
@@ -156,10 +199,10 @@ void DungeonTestState::UpdateGenerateDungeon() {
     
     // Navigate through generation parameters
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP)) {
-        selectedMenuOption = (selectedMenuOption - 1 + 7) % 7;
+        selectedMenuOption = (selectedMenuOption - 1 + 9) % 9;
     }
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_DOWN)) {
-        selectedMenuOption = (selectedMenuOption + 1) % 7;
+        selectedMenuOption = (selectedMenuOption + 1) % 9;
     }
     
     // Modify parameter values
@@ -198,6 +241,13 @@ void DungeonTestState::UpdateGenerateDungeon() {
                     generationParams.loopChance -= 0.1f;
                 }
                 break;
+            case 7: // Seed
+                reuseSeed = !reuseSeed;
+                break;
+            case 8: // Layout
+                generationParams.layout = generationParams.layout == LayoutAlgorithm::RANDOM_WALK
+                    ? LayoutAlgorithm::WAVE_FUNCTION_COLLAPSE : LayoutAlgorithm::RANDOM_WALK;
+                break;
         }
     }
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
@@ -235,6 +285,13 @@ void DungeonTestState::UpdateGenerateDungeon() {
                     generationParams.loopChance += 0.1f;
                 }
                 break;
+            case 7: // Seed
+                reuseSeed = !reuseSeed;
+                break;
+            case 8: // Layout
+                generationParams.layout = generationParams.layout == LayoutAlgorithm::RANDOM_WALK
+                    ? LayoutAlgorithm::WAVE_FUNCTION_COLLAPSE : LayoutAlgorithm::RANDOM_WALK;
+                break;
         }
     }
     
@@ -289,8 +346,8 @@ void DungeonTestState::UpdateViewDungeon() {
     if (input.IsActionJustPressed(Engine::InputAction::ATTACK) && 
         input.IsActionJustPressed(Engine::InputAction::CONFIRM)) {
         // Cycle to next room when pressing attack+confirm together
-        if (!currentDungeon.empty()) {
-            selectedRoomIndex = (selectedRoomIndex + 1) % currentDungeon.size();
+        if (HasDungeon()) {
+            selectedRoomIndex = (selectedRoomIndex + 1) % currentFloor->GetRoomCount();
             uiState = UIState::VIEW_ROOM;
         }
     }
@@ -299,17 +356,13 @@ void DungeonTestState::UpdateViewDungeon() {
 void DungeonTestState::UpdateViewRoom() {
     Engine::InputHandler& input = Engine::InputHandler::GetInstance();
     
-    // Find the selected room
-    auto selectedRoom = std::find_if(currentDungeon.begin(), currentDungeon.end(),
-                                  [this](const std::shared_ptr<Room>& room) {
-                                      return room->GetId() == selectedRoomIndex;
-                                  });
-    
-    if (selectedRoom == currentDungeon.end()) {
+    // Room ids are indices into the floor's room table
+    if (!HasDungeon() || !currentFloor->IsValidRoom(selectedRoomIndex)) {
         // Room not found, go back to dungeon view
         uiState = UIState::VIEW_DUNGEON;
         return;
     }
+    Room& selectedRoom = currentFloor->GetRoom(selectedRoomIndex);
     
     // Navigate to connected rooms
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP) || 
@@ -317,61 +370,65 @@ void DungeonTestState::UpdateViewRoom() {
         input.IsActionJustPressed(Engine::InputAction::MOVE_LEFT) || 
         input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
         
-        // Get the connections
-        const auto& connections = (*selectedRoom)->GetConnections();
+        // Find the closest connected room in the direction pressed
+        int currentX = selectedRoom.GetPositionX();
+        int currentY = selectedRoom.GetPositionY();
         
-        if (!connections.empty()) {
-            // Find the closest room in the direction pressed
-            auto currentRoom = *selectedRoom;
-            int currentX = currentRoom->GetPositionX();
-            int currentY = currentRoom->GetPositionY();
+        int closestRoom = DungeonFloor::NO_ROOM;
+        float closestDistance = std::numeric_limits<float>::max();
+        
+        for (int neighbor : currentFloor->GetNeighbors(selectedRoomIndex)) {
+            const Room& conn = currentFloor->GetRoom(neighbor);
+            int connX = conn.GetPositionX();
+            int connY = conn.GetPositionY();
             
-            std::shared_ptr<Room> closestRoom = nullptr;
-            float closestDistance = std::numeric_limits<float>::max();
+            bool isInDirection = false;
             
-            for (const auto& conn : connections) {
-                int connX = conn->GetPositionX();
-                int connY = conn->GetPositionY();
-                
-                bool isInDirection = false;
-                
-                if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP)) {
-                    isInDirection = connY < currentY;
-                } else if (input.IsActionJustPressed(Engine::InputAction::MOVE_DOWN)) {
-                    isInDirection = connY > currentY;
-                } else if (input.IsActionJustPressed(Engine::InputAction::MOVE_LEFT)) {
-                    isInDirection = connX < currentX;
-                } else if (input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
-                    isInDirection = connX > currentX;
-                }
-                
-                if (isInDirection) {
-                    float distance = std::sqrt(
-                        std::pow(connX - currentX, 2) + 
-                        std::pow(connY - currentY, 2)
-                    );
-                    
-                    if (distance < closestDistance) {
-                        closestDistance = distance;
-                        closestRoom = conn;
-                    }
-                }
+            if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP)) {
+                isInDirection = connY < currentY;
+            } else if (input.IsActionJustPressed(Engine::InputAction::MOVE_DOWN)) {
+                isInDirection = connY > currentY;
+            } else if (input.IsActionJustPressed(Engine::InputAction::MOVE_LEFT)) {
+                isInDirection = connX < currentX;
+            } else if (input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
+                isInDirection = connX > currentX;
             }
             
-            // If we found a room in that direction, select it
-            if (closestRoom) {
-                selectedRoomIndex = closestRoom->GetId();
+            if (isInDirection) {
+                float distance = std::sqrt(
+                    std::pow(connX - currentX, 2) + 
+                    std::pow(connY - currentY, 2)
+                );
+                
+                if (distance < closestDistance) {
+                    closestDistance = distance;
+                    closestRoom = neighbor;
+                }
             }
         }
+        
+        // If we found a room in that direction, select it
+        if (closestRoom != DungeonFloor::NO_ROOM) {
+            selectedRoomIndex = closestRoom;
+        }
     }
     
-    // Visit/clear room
+    // Enter/clear room (entering materializes the encounter, clearing releases it)
     if (input.IsActionJustPressed(Engine::InputAction::ATTACK)) {
-        (*selectedRoom)->Visit();
+        selectedRoom.Enter();
     }
     
     if (input.IsActionJustPressed(Engine::InputAction::USE_ITEM)) {
-        (*selectedRoom)->Clear();
+        selectedRoom.Clear();
+    }
+    
+    // Auto-travel: walk one door along the shortest route to the exit
+    if (input.IsActionJustPressed(Engine::InputAction::MENU)) {
+        const DistanceField& field = currentFloor->GetDistanceField();
+        int nextRoom = field.NextStepToward(*currentFloor, DistanceLane::EXIT, selectedRoomIndex);
+        if (nextRoom != DungeonFloor::NO_ROOM) {
+            selectedRoomIndex = nextRoom;
+        }
     }
     
     // Return to dungeon view
@@ -384,33 +441,169 @@ void DungeonTestState::GenerateDungeon() {
     // Use the DungeonGenerator to create a new dungeon
     DungeonGenerator& generator = DungeonGenerator::GetInstance();
     
+    // Reusing the seed rebuilds the exact same floor, encounters included
+    generationParams.seed = (reuseSeed && currentFloor) ? currentFloor->GetSeed() : 0;
+    
     // Generate the dungeon
-    currentDungeon = generator.GenerateFloor(generationParams);
+    std::shared_ptr<DungeonFloor> floor = generator.GenerateFloor(generationParams);
     
     // If we successfully generated a dungeon
-    if (!currentDungeon.empty()) {
-        std::cout << "Generated a dungeon with " << currentDungeon.size() << " rooms" << std::endl;
-        
-        // Center the view on the dungeon
-        gridOffsetX = 0;
-        gridOffsetY = 0;
-        zoomLevel = 1.0f;
-        
-        // Set the initial selected room to the entrance
-        auto entranceRoom = generator.GetEntranceRoom();
-        if (entranceRoom) {
-            selectedRoomIndex = entranceRoom->GetId();
-        } else {
-            selectedRoomIndex = 0;
+    if (floor && !floor->IsEmpty()) {
+        std::cout << "Generated a dungeon with " << floor->GetRoomCount() << " rooms" << std::endl;
+        
+        // Start a new descent from this floor's seed
+        floorNumber = 1;
+        runSeed = floor->GetSeed();
+        ShowFloor(floor);
+        
+        if (floorCache) {
+            floorCache->Clear();
+            floorCache->SetCurrentFloor(floorNumber);
+            floorCache->Store(floorNumber, currentFloor);
         }
         
-        // Switch to the view dungeon state
-        uiState = UIState::VIEW_DUNGEON;
+        if (preloader) {
+            preloader->Clear();
+            preloader->PrepareAfter(floorNumber);
+        }
     } else {
         std::cerr << "Failed to generate dungeon!" << std::endl;
     }
 }
 
+void DungeonTestState::DescendToNextFloor() {
+    if (!preloader) {
+        return;
+    }
+    
+    int nextFloor = floorNumber + 1;
+    
+    // A floor we climbed up from comes back from the cache
+    if (floorCache && floorCache->Contains(nextFloor)) {
+        ChangeToCachedFloor(nextFloor);
+        preloader->PrepareAfter(floorNumber);
+        return;
+    }
+    
+    bool wasReady = preloader->IsReady(nextFloor);
+    
+    // Blocks only if the worker has not finished the floor yet
+    std::shared_ptr<DungeonFloor> floor = preloader->TakeFloor(nextFloor);
+    if (!floor || floor->IsEmpty()) {
+        std::cerr << "Failed to load floor " << nextFloor << "!" << std::endl;
+        return;
+    }
+    
+    std::cout << "Descended to floor " << nextFloor << " (" << floor->GetRoomCount() << " rooms, "
+              << (wasReady ? "pre-generated" : "waited for worker") << ", built in "
+              << preloader->GetLastBuildMilliseconds() << " ms)" << std::endl;
+    
+    floorNumber = nextFloor;
+    ShowFloor(floor);
+    
+    if (floorCache) {
+        floorCache->SetCurrentFloor(floorNumber);
+        floorCache->Store(floorNumber, currentFloor);
+    }
+    
+    // Keep the worker one step ahead of the player
+    preloader->PrepareAfter(floorNumber);
+}
+
+void DungeonTestState::AscendToPreviousFloor() {
+    if (floorNumber > 1 && floorCache && floorCache->Contains(floorNumber - 1)) {
+        ChangeToCachedFloor(floorNumber - 1);
+    }
+}
+
+void DungeonTestState::ChangeToCachedFloor(int number) {
+    bool wasResident = floorCache->IsResident(number);
+    
+    // Move the pinned window first, so the floor we leave can be paged out
+    floorCache->SetCurrentFloor(number);
+    std::shared_ptr<DungeonFloor> floor = floorCache->Get(number);
+    if (!floor) {
+        std::cerr << "Failed to return to floor " << number << "!" << std::endl;
+        floorCache->SetCurrentFloor(floorNumber);
+        return;
+    }
+    
+    std::cout << "Returned to floor " << number << " (" << (wasResident ? "in memory" : "paged in from disk")
+              << ", " << floorCache->GetResidentCount() << "/" << floorCache->GetFloorCount()
+              << " floors resident)" << std::endl;
+    
+    floorNumber = number;
+    ShowFloor(floor);
+}
+
+void DungeonTestState::ShowFloor(std::shared_ptr<DungeonFloor> floor) {
+    currentFloor = std::move(floor);
+    
+    // Center the view on the dungeon
+    gridOffsetX = 0;
+    gridOffsetY = 0;
+    zoomLevel = 1.0f;
+    
+    // Set the initial selected room to the entrance
+    int entranceIndex = currentFloor->GetEntranceIndex();
+    selectedRoomIndex = (entranceIndex != DungeonFloor::NO_ROOM) ? entranceIndex : 0;
+    
+    // Switch to the view dungeon state
+    uiState = UIState::VIEW_DUNGEON;
+}
+
+void DungeonTestState::SaveFloor() {
+    FloorSaveInfo info;
+    info.floorNumber = floorNumber;
+    info.runSeed = runSeed;
+    
+    auto start = std::chrono::steady_clock::now();
+    if (FloorSerializer::Save(*currentFloor, SAVE_FILE, info)) {
+        std::cout << "Saved floor " << floorNumber << " to " << SAVE_FILE << " in "
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+                  << " ms" << std::endl;
+    }
+}
+
+void DungeonTestState::LoadFloor() {
+    FloorSaveInfo info;
+    
+    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<DungeonFloor> floor = FloorSerializer::Load(SAVE_FILE, &info);
+    if (!floor || floor->IsEmpty()) {
+        std::cerr << "Failed to load saved floor!" << std::endl;
+        return;
+    }
+    
+    std::cout << "Loaded floor " << info.floorNumber << " (" << floor->GetRoomCount() << " rooms) in "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+              << " ms" << std::endl;
+    
+    // Resume the run: the following floors derive from the saved run seed
+    floorNumber = info.floorNumber;
+    runSeed = info.runSeed;
+    ShowFloor(floor);
+    
+    if (floorCache) {
+        floorCache->Clear();
+        floorCache->SetCurrentFloor(floorNumber);
+        floorCache->Store(floorNumber, currentFloor);
+    }
+    
+    if (preloader) {
+        preloader->Clear();
+        preloader->PrepareAfter(floorNumber);
+    }
+}
+
+DungeonGenerationParams DungeonTestState::GetParamsForFloor(int floor) const {
+    // Deeper floors get harder; every floor's seed follows from the run seed
+    DungeonGenerationParams params = generationParams;
+    params.difficulty = generationParams.difficulty + (floor - 1);
+    params.seed = DungeonSeed::ForFloor(runSeed, floor);
+    return params;
+}
+
 std::string DungeonTestState::RoomTypeToString(RoomType type) const {
     switch (type) {
         case RoomType::NORMAL: return "Normal";
@@ -440,7 +633,7 @@ void DungeonTestState::RenderMainMenu() {
     int menuX = 50;
     int menuY = 120;
     int menuWidth = 300;
-    int menuHeight = 200;
+    int menuHeight = 340;
     
     renderer.DrawRect(menuX, menuY, menuWidth, menuHeight, LIGHTGRAY);
     renderer.DrawRectLines(menuX, menuY, menuWidth, menuHeight, BLACK);
@@ -452,6 +645,10 @@ void DungeonTestState::RenderMainMenu() {
     std::vector<std::string> options = {
         "Generate Dungeon",
         "View Current Dungeon",
+        "Descend to Next Floor",
+        "Return to Previous Floor",
+        "Save Floor",
+        "Load Saved Floor",
         "Exit"
     };
     
@@ -463,16 +660,21 @@ void DungeonTestState::RenderMainMenu() {
     }
     
     // Draw current dungeon info
-    if (!currentDungeon.empty()) {
+    if (HasDungeon()) {
         std::stringstream ss;
-        ss << "Current Dungeon: " << currentDungeon.size() << " rooms";
+        ss << "Current Dungeon: " << currentFloor->GetRoomCount() << " rooms";
         renderer.DrawText(ss.str().c_str(), menuX + 20, menuY + menuHeight - 30, 16, DARKGRAY);
+        
+        std::stringstream floorSs;
+        floorSs << "Floor " << floorNumber << " - next floor "
+                << ((preloader && preloader->IsReady(floorNumber + 1)) ? "ready" : "building...");
+        renderer.DrawText(floorSs.str().c_str(), menuX + 20, menuY + menuHeight - 55, 16, DARKGRAY);
     } else {
         renderer.DrawText("No dungeon generated yet", menuX + 20, menuY + menuHeight - 30, 16, DARKGRAY);
     }
     
     // Draw mini dungeon preview if available
-    if (!currentDungeon.empty()) {
+    if (HasDungeon()) {
         int previewX = menuX + menuWidth + 50;
         int previewY = menuY;
         int previewSize = 250;
@@ -480,18 +682,23 @@ void DungeonTestState::RenderMainMenu() {
         renderer.DrawRect(previewX, previewY, previewSize, previewSize, LIGHTGRAY);
         renderer.DrawRectLines(previewX, previewY, previewSize, previewSize, BLACK);
         
-        // Draw a scaled-down version of the dungeon
-        for (const auto& room : currentDungeon) {
-            int x = room->GetPositionX();
-            int y = room->GetPositionY();
+        // Draw a scaled-down version of the dungeon by walking the cell grid
+        int floorWidth = currentFloor->GetWidth();
+        int floorHeight = currentFloor->GetHeight();
+        int roomSize = previewSize / std::max(floorWidth, floorHeight);
+        const std::vector<int>& cells = currentFloor->GetCells();
+        
+        for (int cell = 0; cell < static_cast<int>(cells.size()); ++cell) {
+            if (cells[cell] == DungeonFloor::NO_ROOM) {
+                continue;
+            }
             
             // Scale to fit in preview
-            int roomX = previewX + (x * previewSize) / generationParams.width;
-            int roomY = previewY + (y * previewSize) / generationParams.height;
-            int roomSize = previewSize / std::max(generationParams.width, generationParams.height);
+            int roomX = previewX + ((cell % floorWidth) * previewSize) / floorWidth;
+            int roomY = previewY + ((cell / floorWidth) * previewSize) / floorHeight;
             
             // Draw room
-            Color roomColor = GetRoomColor(room->GetType());
+            Color roomColor = GetRoomColor(currentFloor->GetRoom(cells[cell]).GetType());
             renderer.DrawRect(roomX, roomY, roomSize, roomSize, roomColor);
         }
     }
@@ -504,7 +711,7 @@ void DungeonTestState::RenderGenerateDungeon() {
     int menuX = 50;
     int menuY = 120;
     int menuWidth = 400;
-    int menuHeight = 350;
+    int menuHeight = 410;
     
     renderer.DrawRect(menuX, menuY, menuWidth, menuHeight, LIGHTGRAY);
     renderer.DrawRectLines(menuX, menuY, menuWidth, menuHeight, BLACK);
@@ -524,7 +731,9 @@ void DungeonTestState::RenderGenerateDungeon() {
         {"Treasure Rooms:", std::to_string(generationParams.numTreasureRooms)},
         {"Boss Room:", generationParams.hasBossRoom ? "Yes" : "No"},
         {"Difficulty:", std::to_string(generationParams.difficulty)},
-        {"Loop Chance:", std::to_string(static_cast<int>(generationParams.loopChance * 100)) + "%"}
+        {"Loop Chance:", std::to_string(static_cast<int>(generationParams.loopChance * 100)) + "%"},
+        {"Seed:", (reuseSeed && currentFloor) ? std::to_string(currentFloor->GetSeed()) : "Random"},
+        {"Layout:", generationParams.layout == LayoutAlgorithm::WAVE_FUNCTION_COLLAPSE ? "Wave Function" : "Random Walk"}
     };
     
     for (size_t i = 0; i < params.size(); ++i) {
@@ -598,17 +807,14 @@ void DungeonTestState::RenderViewDungeon() {
 void DungeonTestState::RenderViewRoom() {
     Engine::Renderer& renderer = Engine::Renderer::GetInstance();
     
-    // Find the selected room
-    auto selectedRoom = std::find_if(currentDungeon.begin(), currentDungeon.end(),
-                                  [this](const std::shared_ptr<Room>& room) {
-                                      return room->GetId() == selectedRoomIndex;
-                                  });
-    
-    if (selectedRoom == currentDungeon.end()) {
+    // Room ids are indices into the floor's room table
+    if (!HasDungeon() || !currentFloor->IsValidRoom(selectedRoomIndex)) {
         // Room not found, go back to dungeon view
         uiState = UIState::VIEW_DUNGEON;
         return;
     }
+    const Room& selectedRoom = currentFloor->GetRoom(selectedRoomIndex);
+    NeighborRange connections = currentFloor->GetNeighbors(selectedRoomIndex);
     
     // Draw room details panel
     int panelX = 50;
@@ -621,7 +827,7 @@ void DungeonTestState::RenderViewRoom() {
     
     // Draw room title
     std::stringstream titleSs;
-    titleSs << "Room " << (*selectedRoom)->GetId() << " (" << RoomTypeToString((*selectedRoom)->GetType()) << ")";
+    titleSs << "Room " << selectedRoom.GetId() << " (" << RoomTypeToString(selectedRoom.GetType()) << ")";
     renderer.DrawText(titleSs.str().c_str(), panelX + 10, panelY + 10, 20, BLACK);
     
     // Draw room details
@@ -630,7 +836,7 @@ void DungeonTestState::RenderViewRoom() {
     
     // Position
     std::stringstream posSs;
-    posSs << "Position: (" << (*selectedRoom)->GetPositionX() << ", " << (*selectedRoom)->GetPositionY() << ")";
+    posSs << "Position: (" << selectedRoom.GetPositionX() << ", " << selectedRoom.GetPositionY() << ")";
     renderer.DrawText(posSs.str().c_str(), panelX + 20, y, 18, BLACK);
     y += spacing;
     
@@ -639,7 +845,7 @@ void DungeonTestState::RenderViewRoom() {
     y += spacing;
     
     // Wrap description text
-    std::string desc = (*selectedRoom)->GetDescription();
+    std::string desc = selectedRoom.GetDescription();
     int maxWidth = panelWidth - 40;
     int fontSize = 16;
     int charWidth = 10; // Approximate width of each character
@@ -653,29 +859,49 @@ void DungeonTestState::RenderViewRoom() {
     
     // Status
     std::stringstream statSs;
-    statSs << "Visited: " << ((*selectedRoom)->IsVisited() ? "Yes" : "No") 
-          << "   Cleared: " << ((*selectedRoom)->IsCleared() ? "Yes" : "No");
+    statSs << "Visited: " << (selectedRoom.IsVisited() ? "Yes" : "No") 
+          << "   Cleared: " << (selectedRoom.IsCleared() ? "Yes" : "No");
     renderer.DrawText(statSs.str().c_str(), panelX + 20, y, 18, BLACK);
+    y += spacing;
+    
+    // Walking distances from the floor's distance field
+    const DistanceField& field = currentFloor->GetDistanceField();
+    std::stringstream distSs;
+    distSs << "Doors to entrance: " << field.GetDistance(DistanceLane::ENTRANCE, selectedRoomIndex)
+           << "   exit: " << field.GetDistance(DistanceLane::EXIT, selectedRoomIndex);
+    if (currentFloor->GetBossIndex() != DungeonFloor::NO_ROOM) {
+        distSs << "   boss: " << field.GetDistance(DistanceLane::BOSS, selectedRoomIndex);
+    }
+    renderer.DrawText(distSs.str().c_str(), panelX + 20, y, 18, BLACK);
+    y += spacing;
+    
+    int nextToExit = field.NextStepToward(*currentFloor, DistanceLane::EXIT, selectedRoomIndex);
+    if (nextToExit != DungeonFloor::NO_ROOM) {
+        std::stringstream hintSs;
+        hintSs << "Exit route: through room " << nextToExit;
+        renderer.DrawText(hintSs.str().c_str(), panelX + 20, y, 16, DARKGRAY);
+    }
     y += spacing * 2;
     
     // Connections
     renderer.DrawText("Connections:", panelX + 20, y, 18, BLACK);
     y += spacing;
     
-    const auto& connections = (*selectedRoom)->GetConnections();
     if (connections.empty()) {
         renderer.DrawText("No connections", panelX + 40, y, 16, DARKGRAY);
     } else {
-        for (const auto& conn : connections) {
+        for (int neighbor : connections) {
+            const Room& conn = currentFloor->GetRoom(neighbor);
             std::stringstream connSs;
-            connSs << "Room " << conn->GetId() << " (" << RoomTypeToString(conn->GetType()) << ")";
+            connSs << "Room " << conn.GetId() << " (" << RoomTypeToString(conn.GetType()) << ")";
             renderer.DrawText(connSs.str().c_str(), panelX + 40, y, 16, DARKGRAY);
             y += spacing;
         }
     }
     
     // Draw encounter info if present
-    auto encounter = (*selectedRoom)->GetEncounter();
+    auto encounter = selectedRoom.GetEncounter();
+    const EncounterDescriptor& descriptor = selectedRoom.GetEncounterDescriptor();
     if (encounter) {
         y += spacing;
         std::stringstream encSs;
@@ -684,11 +910,19 @@ void DungeonTestState::RenderViewRoom() {
         y += spacing;
         
         renderer.DrawText(encounter->GetDescription().c_str(), panelX + 40, y, 16, DARKGRAY);
+    } else if (!descriptor.IsEmpty() && !selectedRoom.IsCleared()) {
+        // Not entered yet: only the descriptor exists
+        y += spacing;
+        std::stringstream encSs;
+        encSs << "Encounter: " << (descriptor.boss ? "Boss" : 
+                                   descriptor.type == EncounterType::TREASURE ? "Treasure" : "Combat")
+              << " (level " << descriptor.level << ", not yet entered)";
+        renderer.DrawText(encSs.str().c_str(), panelX + 20, y, 18, BLACK);
     }
     
     // Draw help text
     renderer.DrawText("Arrow Keys: Navigate to Connected Rooms", panelX + 20, panelY + panelHeight - 60, 16, DARKGRAY);
-    renderer.DrawText("A: Visit Room    I: Clear Room", panelX + 20, panelY + panelHeight - 30, 16, DARKGRAY);
+    renderer.DrawText("A: Enter Room    I: Clear Room    Tab: Step Toward Exit", panelX + 20, panelY + panelHeight - 30, 16, DARKGRAY);
     
     // Draw a mini visualization of the room and its connections
     int vizX = panelX + panelWidth + 50;
@@ -705,18 +939,20 @@ void DungeonTestState::RenderViewRoom() {
     int roomSize = 40;
     
     // Draw the selected room in the center
-    Color roomColor = GetRoomColor((*selectedRoom)->GetType());
+    Color roomColor = GetRoomColor(selectedRoom.GetType());
     renderer.DrawRect(centerX - roomSize/2, centerY - roomSize/2, roomSize, roomSize, roomColor);
     
     // Draw the room ID
-    std::string idStr = std::to_string((*selectedRoom)->GetId());
+    std::string idStr = std::to_string(selectedRoom.GetId());
     renderer.DrawText(idStr.c_str(), centerX - 5, centerY - 8, 16, WHITE);
     
     // Draw connections radiating outward
-    for (const auto& conn : connections) {
+    for (int neighbor : connections) {
+        const Room& conn = currentFloor->GetRoom(neighbor);
+        
         // Calculate angle based on connection position relative to selected room
-        int dx = conn->GetPositionX() - (*selectedRoom)->GetPositionX();
-        int dy = conn->GetPositionY() - (*selectedRoom)->GetPositionY();
+        int dx = conn.GetPositionX() - selectedRoom.GetPositionX();
+        int dy = conn.GetPositionY() - selectedRoom.GetPositionY();
         
         float angle = atan2f(dy, dx);
         float distance = 100.0f;
@@ -738,11 +974,11 @@ void DungeonTestState::RenderViewRoom() {
         }
         
         // Draw the connected room
-        Color connColor = GetRoomColor(conn->GetType());
+        Color connColor = GetRoomColor(conn.GetType());
         renderer.DrawRect(connX - roomSize/2, connY - roomSize/2, roomSize, roomSize, connColor);
         
         // Draw the room ID
-        std::string connIdStr = std::to_string(conn->GetId());
+        std::string connIdStr = std::to_string(conn.GetId());
         renderer.DrawText(connIdStr.c_str(), connX - 5, connY - 8, 16, WHITE);
     }
 }
@@ -777,51 +1013,57 @@ void DungeonTestState::DrawDungeonGrid(float offsetX, float offsetY, float cellS
         }
     }
     
-    // Draw connections between rooms first (so they appear behind rooms)
-    for (const auto& room : currentDungeon) {
-        int x = room->GetPositionX();
-        int y = room->GetPositionY();
+    if (!HasDungeon()) {
+        return;
+    }
+    
+    // Draw connections between rooms first (so they appear behind rooms).
+    // Each undirected edge is stored once, so every corridor is drawn once.
+    for (const auto& edge : currentFloor->GetConnections()) {
+        const Room& room = currentFloor->GetRoom(edge.first);
+        const Room& conn = currentFloor->GetRoom(edge.second);
         
-        float roomCenterX = gridX + (x + 0.5f) * cellSize;
-        float roomCenterY = gridY + (y + 0.5f) * cellSize;
+        float roomCenterX = gridX + (room.GetPositionX() + 0.5f) * cellSize;
+        float roomCenterY = gridY + (room.GetPositionY() + 0.5f) * cellSize;
+        float connCenterX = gridX + (conn.GetPositionX() + 0.5f) * cellSize;
+        float connCenterY = gridY + (conn.GetPositionY() + 0.5f) * cellSize;
         
-        // Draw connections
-        for (const auto& conn : room->GetConnections()) {
-            int connX = conn->GetPositionX();
-            int connY = conn->GetPositionY();
-            
-            float connCenterX = gridX + (connX + 0.5f) * cellSize;
-            float connCenterY = gridY + (connY + 0.5f) * cellSize;
-            
-            // Draw a line between centers using small rectangles
-            float dx = connCenterX - roomCenterX;
-            float dy = connCenterY - roomCenterY;
-            float length = std::sqrt(dx*dx + dy*dy);
-            int numSegments = static_cast<int>(length / 2); // Draw a segment every 2 pixels
+        // Draw a line between centers using small rectangles
+        float dx = connCenterX - roomCenterX;
+        float dy = connCenterY - roomCenterY;
+        float length = std::sqrt(dx*dx + dy*dy);
+        int numSegments = static_cast<int>(length / 2); // Draw a segment every 2 pixels
+        
+        for (int i = 0; i < numSegments; i++) {
+            float t = static_cast<float>(i) / numSegments;
+            float x = roomCenterX + t * dx;
+            float y = roomCenterY + t * dy;
             
-            for (int i = 0; i < numSegments; i++) {
-                float t = static_cast<float>(i) / numSegments;
-                float x = roomCenterX + t * dx;
-                float y = roomCenterY + t * dy;
-                
-                renderer.DrawRect(x - 1, y - 1, 2, 2, DARKGRAY);
-            }
+            renderer.DrawRect(x - 1, y - 1, 2, 2, DARKGRAY);
         }
     }
     
-    // Draw rooms
-    for (const auto& room : currentDungeon) {
-        int x = room->GetPositionX();
-        int y = room->GetPositionY();
+    // Draw rooms by walking the cell grid
+    const std::vector<int>& cells = currentFloor->GetCells();
+    int floorWidth = currentFloor->GetWidth();
+    
+    for (int cell = 0; cell < static_cast<int>(cells.size()); ++cell) {
+        if (cells[cell] == DungeonFloor::NO_ROOM) {
+            continue;
+        }
+        
+        const Room& room = currentFloor->GetRoom(cells[cell]);
+        int x = cell % floorWidth;
+        int y = cell / floorWidth;
         
         float roomX = gridX + x * cellSize;
         float roomY = gridY + y * cellSize;
         
         // Draw room
-        Color roomColor = GetRoomColor(room->GetType());
+        Color roomColor = GetRoomColor(room.GetType());
         
         // Make selected room brighter
-        if (room->GetId() == selectedRoomIndex) {
+        if (room.GetId() == selectedRoomIndex) {
             roomColor = WHITE;
             renderer.DrawRectLines(roomX - 2, roomY - 2, cellSize + 4, cellSize + 4, RED);
         }
@@ -832,34 +1074,34 @@ void DungeonTestState::DrawDungeonGrid(float offsetX, float offsetY, float cellS
                         cellSize - 2*padding, cellSize - 2*padding, roomColor);
         
         // Draw visited/cleared indicators
-        if (room->IsVisited()) {
+        if (room.IsVisited()) {
             renderer.DrawRect(roomX + padding, roomY + padding, 10, 10, GREEN);
         }
         
-        if (room->IsCleared()) {
+        if (room.IsCleared()) {
             renderer.DrawRect(roomX + padding + 15, roomY + padding, 10, 10, PURPLE);
         }
         
         // Draw room ID if enabled
         if (showRoomIDs) {
-            std::string idStr = std::to_string(room->GetId());
+            std::string idStr = std::to_string(room.GetId());
             renderer.DrawText(idStr.c_str(), roomX + cellSize/2 - 5, roomY + cellSize/2 - 8, 16, BLACK);
         }
         
         // Draw room type if enabled
         if (showRoomTypes) {
-            std::string typeStr = RoomTypeToString(room->GetType()).substr(0, 1); // First letter only
+            std::string typeStr = RoomTypeToString(room.GetType()).substr(0, 1); // First letter only
             renderer.DrawText(typeStr.c_str(), roomX + cellSize - 15, roomY + 5, 16, BLACK);
         }
         
         // Draw encounter indicator if enabled
-        if (showEncounters && room->GetEncounter()) {
-            auto encounter = room->GetEncounter();
+        if (showEncounters && room.HasEncounter() && !room.IsCleared()) {
+            EncounterType encounterType = room.GetEncounterDescriptor().type;
             std::string encTypeStr;
             
-            if (encounter->GetType() == EncounterType::COMBAT) {
+            if (encounterType == EncounterType::COMBAT) {
                 encTypeStr = "C";
-            } else if (encounter->GetType() == EncounterType::TREASURE) {
+            } else if (encounterType == EncounterType::TREASURE) {
                 encTypeStr = "T";
             } else {
                 encTypeStr = "?";
@@ -873,7 +1115,8 @@ void DungeonTestState::DrawDungeonGrid(float offsetX, float offsetY, float cellS
     renderer.DrawText("Dungeon Grid", gridX, gridY - 30, 20, BLACK);
     
     std::stringstream coordSs;
-    coordSs << "Offset: (" << offsetX << ", " << offsetY << ") Zoom: " << std::fixed << std::setprecision(2) << zoomLevel;
+    coordSs << "Offset: (" << offsetX << ", " << offsetY << ") Zoom: " << std::fixed << std::setprecision(2) << zoomLevel
+            << " Seed: " << currentFloor->GetSeed();
     renderer.DrawText(coordSs.str().c_str(), gridX, gridY - 30 + 20, 16, DARKGRAY);
 }
 
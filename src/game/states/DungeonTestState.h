@@ -2,6 +2,8 @@
 
 #include "../../engine/core/StateManager.h"
 #include "../dungeon/DungeonGenerator.h"
+#include "../dungeon/FloorPreloader.h"
+#include "../dungeon/FloorCache.h"
 #include "../../engine/rendering/Renderer.h"
 #include <memory>
 #include <vector>
@@ -28,9 +30,16 @@ public:
     
 private:
     // Current dungeon state
-    std::vector<std::shared_ptr<Room>> currentDungeon;
+    std::shared_ptr<DungeonFloor> currentFloor;
     DungeonGenerationParams generationParams;
     
+    // Descending: floor 1 is generated directly, deeper floors are built
+    // in the background from the first floor's seed
+    int floorNumber;
+    uint64_t runSeed;
+    std::unique_ptr<FloorPreloader> preloader;
+    std::unique_ptr<FloorCache> floorCache;
+    
     // UI state
     enum class UIState {
         MAIN_MENU,
@@ -52,11 +61,22 @@ private:
     bool showRoomTypes;
     bool showEncounters;
     
+    // Regenerate from the current floor's seed instead of a fresh one
+    bool reuseSeed;
+    
     // State flags
     bool isPaused;
     
     // Helper methods
     void GenerateDungeon();
+    void DescendToNextFloor();
+    void AscendToPreviousFloor();
+    void ChangeToCachedFloor(int number);
+    void ShowFloor(std::shared_ptr<DungeonFloor> floor);
+    void SaveFloor();
+    void LoadFloor();
+    DungeonGenerationParams GetParamsForFloor(int floor) const;
+    bool HasDungeon() const { return currentFloor && !currentFloor->IsEmpty(); }
     
     // UI update methods
     void UpdateMainMenu();
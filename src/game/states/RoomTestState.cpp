@@ -4,6 +4,7 @@
 #include <iostream>
 #include <sstream>
 #include <cmath>
+#include <algorithm>
 
 namespace Game {
 
@@ -14,6 +15,7 @@ RoomTestState::RoomTestState()
       selectedPropertyIndex(0),
       isEditing(false),
       isPaused(false) {
+    floor.Reset(5, 5);
 }
 
 RoomTestState::~RoomTestState() {
@@ -23,37 +25,17 @@ RoomTestState::~RoomTestState() {
 void RoomTestState::Enter() {
     std::cout << "Entering Room Test State" << std::endl;
     
-    // Create a few initial test rooms
-    CreateTestRoom(RoomType::ENTRANCE);
-    CreateTestRoom(RoomType::NORMAL);
-    CreateTestRoom(RoomType::TREASURE);
-    CreateTestRoom(RoomType::BOSS);
-    CreateTestRoom(RoomType::EXIT);
-    
-    // Set positions for visualization
-    if (!rooms.empty()) {
-        rooms[0]->SetPosition(0, 2); // ENTRANCE
-        
-        if (rooms.size() > 1) {
-            rooms[1]->SetPosition(1, 1); // NORMAL
-            
-            if (rooms.size() > 2) {
-                rooms[2]->SetPosition(2, 2); // TREASURE
-                
-                if (rooms.size() > 3) {
-                    rooms[3]->SetPosition(3, 1); // BOSS
-                    
-                    if (rooms.size() > 4) {
-                        rooms[4]->SetPosition(4, 2); // EXIT
-                    }
-                }
-            }
-        }
-    }
+    // Create a few initial test rooms, positioned for visualization
+    floor.Reset(5, 5);
+    CreateTestRoom(RoomType::ENTRANCE, 0, 2);
+    CreateTestRoom(RoomType::NORMAL, 1, 1);
+    CreateTestRoom(RoomType::TREASURE, 2, 2);
+    CreateTestRoom(RoomType::BOSS, 3, 1);
+    CreateTestRoom(RoomType::EXIT, 4, 2);
     
     // Connect initial rooms to form a path
-    for (size_t i = 0; i < rooms.size() - 1; ++i) {
-        ConnectRooms(rooms[i]->GetId(), rooms[i + 1]->GetId());
+    for (int i = 0; i < floor.GetRoomCount() - 1; ++i) {
+        ConnectRooms(i, i + 1);
     }
 }
 
@@ -61,7 +43,7 @@ void RoomTestState::Exit() {
     std::cout << "Exiting Room Test State" << std::endl;
     
     // Clear rooms
-    rooms.clear();
+    floor.Reset(5, 5);
 }
 
 void RoomTestState::Pause() {
@@ -144,54 +126,50 @@ void RoomTestState::Render() {
     renderer.DrawText("ESC: Back/Exit", 50, 700, 16, DARKGRAY);
 }
 
-void RoomTestState::CreateTestRoom(RoomType type) {
-    // Generate a unique ID (simply use the current size)
-    int id = static_cast<int>(rooms.size());
-    
-    // Create the room
-    auto room = std::make_shared<Room>(id, type);
-    
-    // Set a random position for visualization
-    room->SetPosition(id % 5, id / 5);
+void RoomTestState::CreateTestRoom(RoomType type, int x, int y) {
+    // Without an explicit position, use the first free cell of the grid
+    if (x < 0 || y < 0) {
+        const std::vector<int>& cells = floor.GetCells();
+        auto freeCell = std::find(cells.begin(), cells.end(), DungeonFloor::NO_ROOM);
+        if (freeCell == cells.end()) {
+            std::cout << "Failed to create room: the test grid is full" << std::endl;
+            return;
+        }
+        
+        int cell = static_cast<int>(freeCell - cells.begin());
+        x = cell % floor.GetWidth();
+        y = cell / floor.GetWidth();
+    }
     
-    // Add to room list
-    rooms.push_back(room);
+    // Room ids are their index in the floor's room table
+    int id = floor.AddRoom(type, x, y);
+    if (id == DungeonFloor::NO_ROOM) {
+        std::cout << "Failed to create room at (" << x << ", " << y << ")" << std::endl;
+        return;
+    }
     
     std::cout << "Created test room with ID " << id << " of type " << RoomTypeToString(type) << std::endl;
 }
 
 void RoomTestState::ConnectRooms(int roomId1, int roomId2) {
-    // Find rooms with the given IDs
-    auto it1 = std::find_if(rooms.begin(), rooms.end(),
-                           [roomId1](const std::shared_ptr<Room>& room) {
-                               return room->GetId() == roomId1;
-                           });
-    
-    auto it2 = std::find_if(rooms.begin(), rooms.end(),
-                           [roomId2](const std::shared_ptr<Room>& room) {
-                               return room->GetId() == roomId2;
-                           });
-    
-    // Connect the rooms if found
-    if (it1 != rooms.end() && it2 != rooms.end()) {
-        (*it1)->AddConnection(*it2);
-    } else {
+    if (!floor.IsValidRoom(roomId1) || !floor.IsValidRoom(roomId2)) {
         std::cout << "Failed to connect rooms: Room " << roomId1 << " or " << roomId2 << " not found" << std::endl;
+        return;
+    }
+    
+    if (floor.Connect(roomId1, roomId2)) {
+        std::cout << "Connected room " << roomId1 << " to room " << roomId2 << std::endl;
     }
 }
 
 void RoomTestState::RemoveConnection(int roomId1, int roomId2) {
-    // Find the first room
-    auto it = std::find_if(rooms.begin(), rooms.end(),
-                          [roomId1](const std::shared_ptr<Room>& room) {
-                              return room->GetId() == roomId1;
-                          });
-    
-    // Remove the connection if room found
-    if (it != rooms.end()) {
-        (*it)->RemoveConnection(roomId2);
-    } else {
+    if (!floor.IsValidRoom(roomId1)) {
         std::cout << "Failed to remove connection: Room " << roomId1 << " not found" << std::endl;
+        return;
+    }
+    
+    if (floor.Disconnect(roomId1, roomId2)) {
+        std::cout << "Removed connection between room " << roomId1 << " and room " << roomId2 << std::endl;
     }
 }
 
@@ -214,20 +192,20 @@ void RoomTestState::UpdateMainMenu() {
                 selectedRoomIndex = 0; // Reset selection
                 break;
             case 1: // Connect Rooms
-                if (rooms.size() >= 2) {
+                if (floor.GetRoomCount() >= 2) {
                     uiState = UIState::CONNECT_ROOMS;
                     selectedRoomIndex = 0;
                     targetRoomIndex = 1;
                 }
                 break;
             case 2: // View Room
-                if (!rooms.empty()) {
+                if (!floor.IsEmpty()) {
                     uiState = UIState::VIEW_ROOM;
                     selectedRoomIndex = 0;
                 }
                 break;
             case 3: // View Connections
-                if (!rooms.empty()) {
+                if (!floor.IsEmpty()) {
                     uiState = UIState::VIEW_CONNECTIONS;
                     selectedRoomIndex = 0;
                 }
@@ -277,45 +255,40 @@ void RoomTestState::UpdateConnectRooms() {
         // Selecting source room
         if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP) || 
             input.IsActionJustPressed(Engine::InputAction::MOVE_LEFT)) {
-            selectedRoomIndex = (selectedRoomIndex - 1 + rooms.size()) % rooms.size();
+            selectedRoomIndex = (selectedRoomIndex - 1 + floor.GetRoomCount()) % floor.GetRoomCount();
         }
         if (input.IsActionJustPressed(Engine::InputAction::MOVE_DOWN) || 
             input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
-            selectedRoomIndex = (selectedRoomIndex + 1) % rooms.size();
+            selectedRoomIndex = (selectedRoomIndex + 1) % floor.GetRoomCount();
         }
         
         if (input.IsActionJustPressed(Engine::InputAction::CONFIRM)) {
             selectingTarget = true;
-            targetRoomIndex = (selectedRoomIndex + 1) % rooms.size();
+            targetRoomIndex = (selectedRoomIndex + 1) % floor.GetRoomCount();
         }
     } else {
         // Selecting target room
         if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP) || 
             input.IsActionJustPressed(Engine::InputAction::MOVE_LEFT)) {
-            targetRoomIndex = (targetRoomIndex - 1 + rooms.size()) % rooms.size();
+            targetRoomIndex = (targetRoomIndex - 1 + floor.GetRoomCount()) % floor.GetRoomCount();
             if (targetRoomIndex == selectedRoomIndex) {
-                targetRoomIndex = (targetRoomIndex - 1 + rooms.size()) % rooms.size();
+                targetRoomIndex = (targetRoomIndex - 1 + floor.GetRoomCount()) % floor.GetRoomCount();
             }
         }
         if (input.IsActionJustPressed(Engine::InputAction::MOVE_DOWN) || 
             input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
-            targetRoomIndex = (targetRoomIndex + 1) % rooms.size();
+            targetRoomIndex = (targetRoomIndex + 1) % floor.GetRoomCount();
             if (targetRoomIndex == selectedRoomIndex) {
-                targetRoomIndex = (targetRoomIndex + 1) % rooms.size();
+                targetRoomIndex = (targetRoomIndex + 1) % floor.GetRoomCount();
             }
         }
         
         if (input.IsActionJustPressed(Engine::InputAction::CONFIRM)) {
-            // Check if rooms are already connected
-            auto sourceRoom = rooms[selectedRoomIndex];
-            auto targetRoom = rooms[targetRoomIndex];
-            
-            if (sourceRoom->IsConnectedTo(targetRoom->GetId())) {
-                // Disconnect rooms
-                sourceRoom->RemoveConnection(targetRoom->GetId());
+            // Toggle the connection between the two rooms
+            if (floor.AreConnected(selectedRoomIndex, targetRoomIndex)) {
+                RemoveConnection(selectedRoomIndex, targetRoomIndex);
             } else {
-                // Connect rooms
-                sourceRoom->AddConnection(targetRoom);
+                ConnectRooms(selectedRoomIndex, targetRoomIndex);
             }
             
             selectingTarget = false;
@@ -329,21 +302,21 @@ void RoomTestState::UpdateViewRoom() {
     
     // Navigate between rooms
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_LEFT)) {
-        selectedRoomIndex = (selectedRoomIndex - 1 + rooms.size()) % rooms.size();
+        selectedRoomIndex = (selectedRoomIndex - 1 + floor.GetRoomCount()) % floor.GetRoomCount();
     }
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
-        selectedRoomIndex = (selectedRoomIndex + 1) % rooms.size();
+        selectedRoomIndex = (selectedRoomIndex + 1) % floor.GetRoomCount();
     }
     
     // Toggle visited/cleared state
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_UP)) {
-        if (selectedRoomIndex < static_cast<int>(rooms.size())) {
-            rooms[selectedRoomIndex]->Visit();
+        if (selectedRoomIndex < floor.GetRoomCount()) {
+            floor.GetRoom(selectedRoomIndex).Visit();
         }
     }
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_DOWN)) {
-        if (selectedRoomIndex < static_cast<int>(rooms.size())) {
-            rooms[selectedRoomIndex]->Clear();
+        if (selectedRoomIndex < floor.GetRoomCount()) {
+            floor.GetRoom(selectedRoomIndex).Clear();
         }
     }
 }
@@ -353,10 +326,10 @@ void RoomTestState::UpdateViewConnections() {
     
     // Navigate between rooms
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_LEFT)) {
-        selectedRoomIndex = (selectedRoomIndex - 1 + rooms.size()) % rooms.size();
+        selectedRoomIndex = (selectedRoomIndex - 1 + floor.GetRoomCount()) % floor.GetRoomCount();
     }
     if (input.IsActionJustPressed(Engine::InputAction::MOVE_RIGHT)) {
-        selectedRoomIndex = (selectedRoomIndex + 1) % rooms.size();
+        selectedRoomIndex = (selectedRoomIndex + 1) % floor.GetRoomCount();
     }
 }
 
@@ -393,7 +366,7 @@ void RoomTestState::RenderMainMenu() {
     
     // Draw room count
     std::stringstream ss;
-    ss << "Total Rooms: " << rooms.size();
+    ss << "Total Rooms: " << floor.GetRoomCount();
     renderer.DrawText(ss.str().c_str(), menuX + 20, menuY + menuHeight - 30, 16, DARKGRAY);
 }
 
@@ -450,36 +423,33 @@ void RoomTestState::RenderConnectRooms() {
     // Draw source room selection
     renderer.DrawText("Source Room:", menuX + 20, menuY + 50, 18, BLACK);
     
-    if (selectedRoomIndex < static_cast<int>(rooms.size())) {
-        auto room = rooms[selectedRoomIndex];
+    if (selectedRoomIndex < floor.GetRoomCount()) {
+        const Room& room = floor.GetRoom(selectedRoomIndex);
         std::stringstream ss;
-        ss << "Room " << room->GetId() << " (" << RoomTypeToString(room->GetType()) << ")";
+        ss << "Room " << room.GetId() << " (" << RoomTypeToString(room.GetType()) << ")";
         renderer.DrawText(ss.str().c_str(), menuX + 150, menuY + 50, 18, RED);
     }
     
     // Draw target room selection
     renderer.DrawText("Target Room:", menuX + 20, menuY + 80, 18, BLACK);
     
-    if (targetRoomIndex < static_cast<int>(rooms.size())) {
-        auto room = rooms[targetRoomIndex];
+    if (targetRoomIndex < floor.GetRoomCount()) {
+        const Room& room = floor.GetRoom(targetRoomIndex);
         std::stringstream ss;
-        ss << "Room " << room->GetId() << " (" << RoomTypeToString(room->GetType()) << ")";
+        ss << "Room " << room.GetId() << " (" << RoomTypeToString(room.GetType()) << ")";
         renderer.DrawText(ss.str().c_str(), menuX + 150, menuY + 80, 18, BLUE);
     }
     
     // Draw connection status
-    if (selectedRoomIndex < static_cast<int>(rooms.size()) && 
-        targetRoomIndex < static_cast<int>(rooms.size())) {
-        
-        auto sourceRoom = rooms[selectedRoomIndex];
-        auto targetRoom = rooms[targetRoomIndex];
+    if (selectedRoomIndex < floor.GetRoomCount() && 
+        targetRoomIndex < floor.GetRoomCount()) {
         
-        std::string connectionStatus = sourceRoom->IsConnectedTo(targetRoom->GetId()) ?
-            "Connected" : "Not Connected";
+        bool connected = floor.AreConnected(selectedRoomIndex, targetRoomIndex);
+        std::string connectionStatus = connected ? "Connected" : "Not Connected";
         
         renderer.DrawText("Status:", menuX + 20, menuY + 110, 18, BLACK);
         renderer.DrawText(connectionStatus.c_str(), menuX + 150, menuY + 110, 18, 
-                         sourceRoom->IsConnectedTo(targetRoom->GetId()) ? GREEN : RED);
+                         connected ? GREEN : RED);
     }
     
     // Draw instructions
@@ -503,39 +473,39 @@ void RoomTestState::RenderViewRoom() {
     renderer.DrawText("View Room", menuX + 10, menuY + 10, 20, BLACK);
     
     // Draw room information
-    if (selectedRoomIndex < static_cast<int>(rooms.size())) {
-        auto room = rooms[selectedRoomIndex];
+    if (selectedRoomIndex < floor.GetRoomCount()) {
+        const Room& room = floor.GetRoom(selectedRoomIndex);
         
         // Basic info
         std::stringstream idss;
-        idss << "Room ID: " << room->GetId();
+        idss << "Room ID: " << room.GetId();
         renderer.DrawText(idss.str().c_str(), menuX + 20, menuY + 50, 18, BLACK);
         
         std::stringstream typess;
-        typess << "Type: " << RoomTypeToString(room->GetType());
+        typess << "Type: " << RoomTypeToString(room.GetType());
         renderer.DrawText(typess.str().c_str(), menuX + 20, menuY + 80, 18, BLACK);
         
         // Description
         renderer.DrawText("Description:", menuX + 20, menuY + 110, 18, BLACK);
-        renderer.DrawText(room->GetDescription().c_str(), menuX + 20, menuY + 140, 14, DARKGRAY);
+        renderer.DrawText(room.GetDescription().c_str(), menuX + 20, menuY + 140, 14, DARKGRAY);
         
         // Position
         std::stringstream posss;
-        posss << "Position: (" << room->GetPositionX() << ", " << room->GetPositionY() << ")";
+        posss << "Position: (" << room.GetPositionX() << ", " << room.GetPositionY() << ")";
         renderer.DrawText(posss.str().c_str(), menuX + 20, menuY + 180, 18, BLACK);
         
         // State
         std::stringstream statess;
-        statess << "Visited: " << (room->IsVisited() ? "Yes" : "No");
+        statess << "Visited: " << (room.IsVisited() ? "Yes" : "No");
         renderer.DrawText(statess.str().c_str(), menuX + 20, menuY + 210, 18, BLACK);
         
         std::stringstream clearss;
-        clearss << "Cleared: " << (room->IsCleared() ? "Yes" : "No");
+        clearss << "Cleared: " << (room.IsCleared() ? "Yes" : "No");
         renderer.DrawText(clearss.str().c_str(), menuX + 20, menuY + 240, 18, BLACK);
         
         // Connections
         std::stringstream connss;
-        connss << "Connections: " << room->GetConnections().size();
+        connss << "Connections: " << floor.GetNeighbors(selectedRoomIndex).size();
         renderer.DrawText(connss.str().c_str(), menuX + 20, menuY + 270, 18, BLACK);
     }
     
@@ -560,15 +530,15 @@ void RoomTestState::RenderViewConnections() {
     renderer.DrawText("View Connections", menuX + 10, menuY + 10, 20, BLACK);
     
     // Draw selected room
-    if (selectedRoomIndex < static_cast<int>(rooms.size())) {
-        auto room = rooms[selectedRoomIndex];
+    if (selectedRoomIndex < floor.GetRoomCount()) {
+        const Room& room = floor.GetRoom(selectedRoomIndex);
         
         std::stringstream ss;
-        ss << "Room " << room->GetId() << " (" << RoomTypeToString(room->GetType()) << ")";
+        ss << "Room " << room.GetId() << " (" << RoomTypeToString(room.GetType()) << ")";
         renderer.DrawText(ss.str().c_str(), menuX + 20, menuY + 50, 18, RED);
         
         // Draw connections
-        const auto& connections = room->GetConnections();
+        NeighborRange connections = floor.GetNeighbors(selectedRoomIndex);
         
         if (connections.empty()) {
             renderer.DrawText("No connections", menuX + 20, menuY + 90, 16, DARKGRAY);
@@ -576,9 +546,10 @@ void RoomTestState::RenderViewConnections() {
             renderer.DrawText("Connected to:", menuX + 20, menuY + 90, 18, BLACK);
             
             int y = menuY + 120;
-            for (const auto& conn : connections) {
+            for (int neighbor : connections) {
+                const Room& conn = floor.GetRoom(neighbor);
                 std::stringstream connss;
-                connss << "Room " << conn->GetId() << " (" << RoomTypeToString(conn->GetType()) << ")";
+                connss << "Room " << conn.GetId() << " (" << RoomTypeToString(conn.GetType()) << ")";
                 renderer.DrawText(connss.str().c_str(), menuX + 40, y, 16, BLUE);
                 y += 25;
             }
@@ -620,19 +591,16 @@ void RoomTestState::DrawRoomGrid() {
             renderer.DrawRect(cellX, cellY, cellSize, cellSize, LIGHTGRAY);
             renderer.DrawRectLines(cellX, cellY, cellSize, cellSize, DARKGRAY);
             
-            // Find room at this position
-            auto it = std::find_if(rooms.begin(), rooms.end(),
-                                 [x, y](const std::shared_ptr<Room>& room) {
-                                     return room->GetPositionX() == x && room->GetPositionY() == y;
-                                 });
+            // Look up the room occupying this cell
+            int roomIndex = floor.GetRoomAt(x, y);
             
             // Draw room if found
-            if (it != rooms.end()) {
-                auto room = *it;
+            if (roomIndex != DungeonFloor::NO_ROOM) {
+                const Room& room = floor.GetRoom(roomIndex);
                 
                 // Choose color based on room type
                 Engine::RColor color;
-                switch (room->GetType()) {
+                switch (room.GetType()) {
                     case RoomType::NORMAL: color = BLUE; break;
                     case RoomType::TREASURE: color = GOLD; break;
                     case RoomType::BOSS: color = RED; break;
@@ -645,13 +613,13 @@ void RoomTestState::DrawRoomGrid() {
                 renderer.DrawRect(cellX + 5, cellY + 5, cellSize - 10, cellSize - 10, color);
                 
                 // Draw room ID
-                std::string idStr = std::to_string(room->GetId());
+                std::string idStr = std::to_string(room.GetId());
                 renderer.DrawText(idStr.c_str(), cellX + cellSize / 2 - 5, cellY + cellSize / 2 - 8, 16, WHITE);
                 
                 // Draw connections
-                for (const auto& conn : room->GetConnections()) {
-                    int targetX = conn->GetPositionX();
-                    int targetY = conn->GetPositionY();
+                for (int neighbor : floor.GetNeighbors(roomIndex)) {
+                    int targetX = floor.GetRoom(neighbor).GetPositionX();
+                    int targetY = floor.GetRoom(neighbor).GetPositionY();
                     
                     // Calculate center points
                     int startX = cellX + cellSize / 2;
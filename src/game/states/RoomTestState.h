@@ -1,7 +1,7 @@
 #pragma once
 
 #include "../../engine/core/StateManager.h"
-#include "../dungeon/Room.h"
+#include "../dungeon/DungeonFloor.h"
 #include <memory>
 #include <vector>
 #include <string>
@@ -26,8 +26,8 @@ public:
     std::string GetStateName() const override { return "RoomTestState"; }
     
 private:
-    // Test rooms
-    std::vector<std::shared_ptr<Room>> rooms;
+    // Test rooms laid out on a small floor grid
+    DungeonFloor floor;
     
     // UI state
     enum class UIState {
@@ -52,7 +52,7 @@ private:
     bool isPaused;
     
     // Helper methods
-    void CreateTestRoom(RoomType type);
+    void CreateTestRoom(RoomType type, int x = -1, int y = -1);
     void ConnectRooms(int roomId1, int roomId2);
     void RemoveConnection(int roomId1, int roomId2);
     void UpdateMainMenu();
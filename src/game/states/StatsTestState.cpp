@@ -1,6 +1,7 @@
 #include "StatsTestState.h"
 #include "../../engine/input/InputHandler.h"
 #include "../entities/components/StatsComponent.h"
+#include "../combat/ResolutionEngine.h"
 #include <iostream>
 
 namespace Game {
@@ -91,6 +92,12 @@ void StatsTestState::Update(float deltaTime) {
         damageTestMode = !damageTestMode;
     }
     
+    // Check the precomputed hit/crit/block tables against the per-roll rules
+    if (input.IsActionJustPressed(Engine::InputAction::MENU)) {
+        ResolutionEngine validator;
+        validator.ValidateAgainstLegacyRules();
+    }
+    
     // Exit on cancel
     if (input.IsActionJustPressed(Engine::InputAction::CANCEL)) {
         Engine::StateManager::GetInstance().PopState();
@@ -256,6 +263,9 @@ void StatsTestState::RenderControls(int y) {
     renderer.DrawText("X: Toggle damage test mode", 50, y, 16, DARKGRAY);
     y += 20;
     
+    renderer.DrawText("TAB: Validate outcome tables (console)", 50, y, 16, DARKGRAY);
+    y += 20;
+    
     renderer.DrawText("ESC: Exit test", 50, y, 16, DARKGRAY);
 }
 
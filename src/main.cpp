@@ -16,11 +16,14 @@
 
 // Function to handle key press events
 void OnKeyPressed(const Engine::Event& event) {
-    int keyCode = event.GetIntData("key_code");
-    int actionId = event.GetIntData("action");
+    const Engine::KeyEvent* key = event.Get<Engine::KeyEvent>();
+    if (!key) {
+        return;
+    }
+    int keyCode = key->keyCode;
     
     // Convert action ID to enum for readability
-    Engine::InputAction action = static_cast<Engine::InputAction>(actionId);
+    Engine::InputAction action = static_cast<Engine::InputAction>(key->action);
     
     // Print action information
     std::string actionName;
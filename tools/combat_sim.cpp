@@ -0,0 +1,149 @@
+// Headless combat simulator for balancing encounters.
+// Auto-resolves many seeded combat encounters against a fixed hero across
+// all cores and prints the win rate, fight length and damage exchanged.
+// Build and run with: make sim-combat SIM_ARGS="--fights 5000 --difficulty 5"
+
+#include "data/ContentPipeline.h"
+#include "data/ActionDataLoader.h"
+#include "game/combat/CombatLog.h"
+#include "game/dungeon/encounters/CombatEncounter.h"
+#include "game/entities/components/StatsComponent.h"
+#include "game/entities/components/PositionComponent.h"
+#include "game/entities/components/StatusEffectsComponent.h"
+#include "game/entities/components/ActionSetComponent.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Game;
+
+namespace {
+
+struct SimOptions {
+    int fights = 1000;
+    int threads = 0;                // 0 = one per hardware thread
+    int difficulty = 3;
+    uint64_t baseSeed = 1;
+};
+
+void PrintUsage() {
+    std::cerr << "Usage: combat_sim [--fights N] [--threads N] [--seed S] [--difficulty N]" << std::endl;
+}
+
+bool ParseOptions(int argc, char** argv, SimOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (!value) {
+            PrintUsage();
+            return false;
+        }
+
+        if (arg == "--fights") options.fights = std::max(1, std::atoi(value));
+        else if (arg == "--threads") options.threads = std::max(0, std::atoi(value));
+        else if (arg == "--seed") options.baseSeed = std::strtoull(value, nullptr, 10);
+        else if (arg == "--difficulty") options.difficulty = std::max(1, std::atoi(value));
+        else {
+            PrintUsage();
+            return false;
+        }
+        ++i;
+    }
+
+    return true;
+}
+
+// Same stats and loadout as the combat test screen's player
+std::shared_ptr<Entity> CreateHero() {
+    auto hero = std::make_shared<Entity>("Hero");
+    hero->AddComponent<StatsComponent>().Initialize(12, 10, 12, 10, 15, 10, 8);
+    hero->AddComponent<PositionComponent>();
+    hero->AddComponent<StatusEffectsComponent>();
+
+    ActionDataLoader& actionLoader = ActionDataLoader::GetInstance();
+    auto& actionSet = hero->AddComponent<ActionSetComponent>();
+    for (const char* actionId : {"slash", "quick_stab", "fireball", "heal", "advance", "retreat"}) {
+        if (actionLoader.HasAction(actionId)) {
+            actionSet.AddAction(actionLoader.GetActionRef(actionId));
+        }
+    }
+    return hero;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    SimOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    if (!ContentPipeline::GetInstance().WaitUntilReady()) {
+        std::cerr << "Failed to load content" << std::endl;
+        return 1;
+    }
+
+    int threadCount = options.threads > 0 ? options.threads
+                                          : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    threadCount = std::min(threadCount, options.fights);
+
+    std::vector<AutoResolveSummary> results(options.fights);
+    std::atomic<int> nextFight(0);
+
+    // Each worker silences its own combat log; the fights run in parallel
+    // without touching std::cout, so this thread's output is unaffected
+    auto worker = [&]() {
+        CombatLog::Scope silence(CombatLog::Silent());
+
+        for (int index = nextFight++; index < options.fights; index = nextFight++) {
+            CombatEncounter encounter("Simulated fight", options.difficulty);
+            encounter.SetSeed(options.baseSeed + static_cast<uint64_t>(index));
+            encounter.SetPlayerTeam({CreateHero()});
+            results[index] = encounter.AutoResolve();
+        }
+    };
+
+    auto simStart = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - simStart).count();
+
+    int victories = 0, defeats = 0, unfinished = 0;
+    double turns = 0.0, rounds = 0.0, damageDealt = 0.0, damageTaken = 0.0;
+    for (const AutoResolveSummary& summary : results) {
+        if (summary.result == EncounterResult::VICTORY) victories++;
+        else if (summary.result == EncounterResult::DEFEAT) defeats++;
+        else unfinished++;
+        turns += summary.turns;
+        rounds += summary.rounds;
+        damageDealt += summary.damageDealt;
+        damageTaken += summary.damageTaken;
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << options.fights << " fights at difficulty " << options.difficulty << " on " << threadCount
+              << " threads in " << seconds * 1000.0 << " ms ("
+              << std::setprecision(0) << options.fights / seconds << " fights/sec)" << std::endl
+              << std::setprecision(1)
+              << "  victories " << 100.0 * victories / options.fights << "%"
+              << ", defeats " << 100.0 * defeats / options.fights << "%"
+              << ", unfinished " << 100.0 * unfinished / options.fights << "%" << std::endl
+              << "  mean turns " << turns / options.fights
+              << ", rounds " << rounds / options.fights
+              << ", damage dealt " << damageDealt / options.fights
+              << ", damage taken " << damageTaken / options.fights << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Headless content loading benchmark.
+// Writes a synthetic items pack of the requested size, then loads it with
+// the streaming DataLoader path and with a full json DOM, and reports
+// throughput (MB/s) and peak memory for each.
+// Build and run with: make bench-content (CONTENT_BENCH_MB=64 for a larger pack)
+
+#include "data/schemas/ItemData.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+
+using namespace Game;
+
+namespace {
+
+const char* SLOTS[] = {"weapon", "chest", "head", "legs", "ring"};
+
+// Peak resident set size of the process so far, in MB
+double PeakMemoryMb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+}
+
+// Write items until the file reaches the target size; returns the item count
+int WritePack(const std::string& path, size_t targetBytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << "{\n";
+
+    int count = 0;
+    size_t written = 2;
+    while (written < targetBytes) {
+        std::string entry = std::string(count > 0 ? ",\n" : "") +
+            "    \"item_" + std::to_string(count) + "\": {\n" +
+            "        \"name\": \"Generated Item " + std::to_string(count) + "\",\n" +
+            "        \"description\": \"A procedurally generated item used to measure content loading.\",\n" +
+            "        \"value\": " + std::to_string(count % 500) + ",\n" +
+            "        \"weight\": " + std::to_string(count % 20) + ",\n" +
+            "        \"equippable\": " + (count % 3 != 0 ? "true" : "false") + ",\n" +
+            "        \"equipSlot\": \"" + SLOTS[count % 5] + "\",\n" +
+            "        \"tags\": [\"generated\", \"tier" + std::to_string(count % 4) + "\"],\n" +
+            "        \"bonuses\": { \"str\": " + std::to_string(count % 3) + ", \"dex\": " +
+            std::to_string(count % 2) + " }\n" +
+            "    }";
+        out << entry;
+        written += entry.size();
+        count++;
+    }
+
+    out << "\n}\n";
+    return count;
+}
+
+void Report(const char* label, size_t bytes, size_t items, double seconds, double peakMb) {
+    std::cout << std::left << std::setw(10) << label << std::right
+              << std::setw(10) << items
+              << std::setw(12) << std::fixed << std::setprecision(1) << seconds * 1000.0
+              << std::setw(10) << bytes / (1024.0 * 1024.0) / seconds
+              << std::setw(12) << peakMb << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32;
+    const std::string path = "content_bench_items.json";
+
+    int generated = WritePack(path, megabytes * 1024 * 1024);
+    std::ifstream probe(path, std::ios::binary | std::ios::ate);
+    const size_t bytes = static_cast<size_t>(probe.tellg());
+    std::cout << "Generated " << generated << " items (" << std::setprecision(1) << std::fixed
+              << bytes / (1024.0 * 1024.0) << " MB)" << std::endl << std::endl;
+
+    std::cout << std::left << std::setw(10) << "loader" << std::right
+              << std::setw(10) << "items" << std::setw(12) << "ms"
+              << std::setw(10) << "MB/s" << std::setw(12) << "peak MB" << std::endl;
+
+    // Streaming first: peak memory only ever grows, so the DOM run after
+    // it shows its own, larger peak
+    {
+        ItemLoader loader;
+        if (!loader.LoadFromFile(path)) {
+            return 1;
+        }
+        const ContentLoadStats& stats = loader.GetLastLoadStats();
+        Report("stream", stats.bytes, stats.items, stats.seconds, PeakMemoryMb());
+    }
+
+    {
+        auto start = std::chrono::steady_clock::now();
+        ItemLoader loader;
+        std::ifstream file(path, std::ios::binary);
+        json data = json::parse(file);
+        loader.LoadFromJson(data);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Report("dom", bytes, loader.GetItems().size(), seconds, PeakMemoryMb());
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,695 @@
+// Build-time content compiler.
+// Validates the JSON content schemas and writes them as one binary content
+// pack (see src/data/ContentPack.h) that the game maps at startup instead
+// of parsing JSON. Every problem is reported with its file and key before
+// the compiler gives up, so one run shows everything that needs fixing.
+// Build and run with: make content
+
+#include "data/ContentPack.h"
+#include "data/json.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Game;
+using json = nlohmann::json;
+
+namespace {
+
+const char* ACTION_TYPES[] = {"ATTACK", "BUFF", "DEBUFF", "HEAL", "MOVEMENT", "SPECIAL", "COMPOUND"};
+const char* TARGET_SHAPES[] = {"SINGLE", "TILE_RANGE", "SIDE", "CHAIN"};
+const char* ITEM_BONUSES[] = {"str", "dex", "con", "int", "spd"};
+const char* ENEMY_STATS[] = {"str", "int", "spd", "dex", "con", "def", "lck"};  // StatType order
+
+// Collects problems for one source file
+class Validator {
+public:
+    explicit Validator(const std::string& filePath) : filePath(filePath) {}
+
+    void Error(const std::string& key, const std::string& message) {
+        std::cerr << filePath << ": " << key << ": error: " << message << std::endl;
+        errors++;
+    }
+
+    void Warning(const std::string& key, const std::string& message) {
+        std::cerr << filePath << ": " << key << ": warning: " << message << std::endl;
+    }
+
+    // Optional string field; a present field of the wrong type is an error
+    std::string String(const json& object, const std::string& key, const char* field, bool required,
+                       const std::string& fallback = "") {
+        auto it = object.find(field);
+        if (it == object.end()) {
+            if (required) {
+                Error(key, std::string("missing required field '") + field + "'");
+            }
+            return fallback;
+        }
+        if (!it->is_string()) {
+            Error(key, std::string("'") + field + "' must be a string");
+            return fallback;
+        }
+        return it->get<std::string>();
+    }
+
+    // Optional integer field with an allowed range
+    int32_t Int(const json& object, const std::string& key, const char* field, int32_t fallback,
+                int32_t minValue, int32_t maxValue) {
+        auto it = object.find(field);
+        if (it == object.end()) {
+            return fallback;
+        }
+        if (!it->is_number_integer()) {
+            Error(key, std::string("'") + field + "' must be an integer");
+            return fallback;
+        }
+        long long value = it->get<long long>();
+        if (value < minValue || value > maxValue) {
+            Error(key, std::string("'") + field + "' is " + std::to_string(value) + ", expected " +
+                       std::to_string(minValue) + ".." + std::to_string(maxValue));
+            return fallback;
+        }
+        return static_cast<int32_t>(value);
+    }
+
+    bool Bool(const json& object, const std::string& key, const char* field, bool fallback) {
+        auto it = object.find(field);
+        if (it == object.end()) {
+            return fallback;
+        }
+        if (!it->is_boolean()) {
+            Error(key, std::string("'") + field + "' must be true or false");
+            return fallback;
+        }
+        return it->get<bool>();
+    }
+
+    // Index of a string field's value in a list of names
+    template<size_t N>
+    uint8_t Enum(const json& object, const std::string& key, const char* field, const char* (&names)[N],
+                 bool required) {
+        std::string value = String(object, key, field, required, names[0]);
+        for (size_t i = 0; i < N; ++i) {
+            if (value == names[i]) {
+                return static_cast<uint8_t>(i);
+            }
+        }
+        Error(key, std::string("unknown ") + field + " '" + value + "'");
+        return 0;
+    }
+
+    int GetErrorCount() const { return errors; }
+
+private:
+    std::string filePath;
+    int errors = 0;
+};
+
+// Pack under construction: records plus a deduplicated string table
+struct PackBuilder {
+    std::vector<char> strings;
+    std::unordered_map<std::string, ContentPack::StringRef> stringRefs;
+    std::vector<ContentPack::ActionRecord> actions;
+    std::vector<ContentPack::PropertyRecord> properties;
+    std::vector<ContentPack::ItemRecord> items;
+    std::vector<ContentPack::EnemyRecord> enemies;
+    std::vector<ContentPack::StringRef> enemyActions;
+    std::vector<ContentPack::LootTableRecord> lootTables;
+    std::vector<ContentPack::LootEntryRecord> lootEntries;
+    std::set<std::string> actionIds;
+    std::set<std::string> itemIds;
+    std::set<std::string> enemyIds;
+
+    // Loot table references are checked once every table is known
+    std::map<std::string, std::vector<std::string>> lootTableRefs;
+    std::map<std::string, std::string> lootTableFiles;
+
+    ContentPack::StringRef AddString(const std::string& text) {
+        auto found = stringRefs.find(text);
+        if (found != stringRefs.end()) {
+            return found->second;
+        }
+
+        ContentPack::StringRef ref = {static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(text.size())};
+        strings.insert(strings.end(), text.begin(), text.end());
+        stringRefs.emplace(text, ref);
+        return ref;
+    }
+};
+
+bool ParseFile(const std::string& filePath, json& data) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        std::cerr << filePath << ": error: cannot open file" << std::endl;
+        return false;
+    }
+
+    data = json::parse(file, nullptr, false);
+    if (data.is_discarded()) {
+        std::cerr << filePath << ": error: not valid JSON" << std::endl;
+        return false;
+    }
+    if (!data.is_object()) {
+        std::cerr << filePath << ": error: expected an object keyed by content ID" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int CompileActions(const std::string& filePath, PackBuilder& pack) {
+    json data;
+    if (!ParseFile(filePath, data)) {
+        return 1;
+    }
+
+    Validator check(filePath);
+    for (const auto& [id, action] : data.items()) {
+        if (!action.is_object()) {
+            check.Error(id, "expected an object");
+            continue;
+        }
+        if (!pack.actionIds.insert(id).second) {
+            check.Error(id, "action ID is already defined by an earlier file");
+            continue;
+        }
+
+        ContentPack::ActionRecord record = {};
+        record.id = pack.AddString(id);
+        record.name = pack.AddString(check.String(action, id, "name", true));
+        record.description = pack.AddString(check.String(action, id, "description", false));
+        record.type = check.Enum(action, id, "type", ACTION_TYPES, true);
+        record.targetShape = action.contains("target_shape")
+            ? check.Enum(action, id, "target_shape", TARGET_SHAPES, false) : 0;
+
+        // Defaults match Action's member initialisers
+        record.accuracy = check.Int(action, id, "accuracy", 100, 0, 100);
+        record.range = check.Int(action, id, "range", 1, 0, 1000);
+        record.cooldown = check.Int(action, id, "cooldown", 0, 0, 1000);
+        record.area = check.Int(action, id, "area", 0, 0, 1000);
+        record.splashPercent = check.Int(action, id, "splash_percent", 100, 0, 1000);
+
+        // "damage" is stored as a property, and entries in "properties"
+        // override it, as with the JSON loader
+        std::map<std::string, int32_t> values;
+        if (action.contains("damage")) {
+            values["damage"] = check.Int(action, id, "damage", 0, -1000000, 1000000);
+        }
+        auto props = action.find("properties");
+        if (props != action.end()) {
+            if (!props->is_object()) {
+                check.Error(id, "'properties' must be an object");
+            } else {
+                for (const auto& [key, value] : props->items()) {
+                    values[key] = check.Int(*props, id, key.c_str(), 0, -1000000, 1000000);
+                }
+            }
+        }
+
+        record.firstProperty = static_cast<uint32_t>(pack.properties.size());
+        record.propertyCount = static_cast<uint32_t>(values.size());
+        for (const auto& [key, value] : values) {
+            ContentPack::PropertyRecord property = {};
+            property.key = pack.AddString(key);
+            property.value = value;
+            pack.properties.push_back(property);
+        }
+
+        pack.actions.push_back(record);
+    }
+
+    std::cout << filePath << ": " << data.size() << " actions" << std::endl;
+    return check.GetErrorCount();
+}
+
+int CompileItems(const std::string& filePath, PackBuilder& pack) {
+    json data;
+    if (!ParseFile(filePath, data)) {
+        return 1;
+    }
+
+    Validator check(filePath);
+    for (const auto& [id, item] : data.items()) {
+        if (!item.is_object()) {
+            check.Error(id, "expected an object");
+            continue;
+        }
+        if (!pack.itemIds.insert(id).second) {
+            check.Error(id, "item ID is already defined by an earlier file");
+            continue;
+        }
+
+        ContentPack::ItemRecord record = {};
+        record.id = pack.AddString(id);
+        record.name = pack.AddString(check.String(item, id, "name", true, "Unknown Item"));
+        record.description = pack.AddString(check.String(item, id, "description", false));
+        record.value = check.Int(item, id, "value", 0, 0, 1000000000);
+        record.weight = check.Int(item, id, "weight", 0, 0, 1000000);
+        record.equippable = check.Bool(item, id, "equippable", false) ? 1 : 0;
+        record.equipSlot = pack.AddString(check.String(item, id, "equipSlot", record.equippable != 0));
+
+        int32_t bonuses[5] = {};
+        auto bonusData = item.find("bonuses");
+        if (bonusData != item.end()) {
+            if (!bonusData->is_object()) {
+                check.Error(id, "'bonuses' must be an object");
+            } else {
+                for (int i = 0; i < 5; ++i) {
+                    bonuses[i] = check.Int(*bonusData, id, ITEM_BONUSES[i], 0, -1000, 1000);
+                }
+                for (const auto& [stat, value] : bonusData->items()) {
+                    bool known = false;
+                    for (const char* name : ITEM_BONUSES) {
+                        known = known || stat == name;
+                    }
+                    if (!known) {
+                        check.Warning(id, "bonus '" + stat + "' is not used by items and is dropped");
+                    }
+                }
+            }
+        }
+        record.strBonus = bonuses[0];
+        record.dexBonus = bonuses[1];
+        record.conBonus = bonuses[2];
+        record.intBonus = bonuses[3];
+        record.spdBonus = bonuses[4];
+
+        pack.items.push_back(record);
+    }
+
+    std::cout << filePath << ": " << data.size() << " items" << std::endl;
+    return check.GetErrorCount();
+}
+
+int CompileEnemies(const std::string& filePath, PackBuilder& pack) {
+    json data;
+    if (!ParseFile(filePath, data)) {
+        return 1;
+    }
+
+    Validator check(filePath);
+    uint32_t tierWeights[ContentPack::ENEMY_TIERS] = {};
+    for (const auto& [id, enemy] : data.items()) {
+        if (!enemy.is_object()) {
+            check.Error(id, "expected an object");
+            continue;
+        }
+        if (!pack.enemyIds.insert(id).second) {
+            check.Error(id, "enemy ID is already defined by an earlier file");
+            continue;
+        }
+
+        ContentPack::EnemyRecord record = {};
+        record.id = pack.AddString(id);
+        record.name = pack.AddString(check.String(enemy, id, "name", true, "Enemy"));
+
+        auto stats = enemy.find("stats");
+        if (stats != enemy.end()) {
+            if (!stats->is_object()) {
+                check.Error(id, "'stats' must be an object");
+            } else {
+                for (int i = 0; i < 7; ++i) {
+                    record.statOffsets[i] = check.Int(*stats, id, ENEMY_STATS[i], 0, -1000, 1000);
+                }
+                for (const auto& [stat, value] : stats->items()) {
+                    bool known = false;
+                    for (const char* name : ENEMY_STATS) {
+                        known = known || stat == name;
+                    }
+                    if (!known) {
+                        check.Error(id, "unknown stat '" + stat + "'");
+                    }
+                }
+            }
+        }
+
+        record.health = check.Int(enemy, id, "health", 0, 0, 1000000);
+        record.healthPerLevel = check.Int(enemy, id, "healthPerLevel", 0, 0, 1000000);
+
+        // Actions must already be compiled, so --actions comes first
+        record.firstAction = static_cast<uint32_t>(pack.enemyActions.size());
+        auto actionList = enemy.find("actions");
+        if (actionList != enemy.end()) {
+            if (!actionList->is_array()) {
+                check.Error(id, "'actions' must be an array of action IDs");
+            } else {
+                for (const auto& action : *actionList) {
+                    if (!action.is_string()) {
+                        check.Error(id, "'actions' must be an array of action IDs");
+                    } else if (pack.actionIds.count(action.get<std::string>()) == 0) {
+                        check.Error(id, "unknown action '" + action.get<std::string>() + "'");
+                    } else {
+                        pack.enemyActions.push_back(pack.AddString(action.get<std::string>()));
+                    }
+                }
+            }
+        }
+        record.actionCount = static_cast<uint32_t>(pack.enemyActions.size()) - record.firstAction;
+
+        // Omitted weights spawn the enemy at every difficulty, as in EnemyData
+        for (uint32_t& weight : record.spawnWeights) {
+            weight = 1;
+        }
+        auto weights = enemy.find("spawnWeights");
+        if (weights != enemy.end()) {
+            if (!weights->is_array() || weights->size() != ContentPack::ENEMY_TIERS) {
+                check.Error(id, "'spawnWeights' must be an array of " + std::to_string(ContentPack::ENEMY_TIERS) +
+                                " weights, one per difficulty tier");
+            } else {
+                for (uint32_t tier = 0; tier < ContentPack::ENEMY_TIERS; ++tier) {
+                    const json& weight = (*weights)[tier];
+                    if (!weight.is_number_integer() || weight.get<long long>() < 0 ||
+                        weight.get<long long>() > 1000000) {
+                        check.Error(id, "spawn weights must be integers in 0..1000000");
+                        continue;
+                    }
+                    record.spawnWeights[tier] = weight.get<uint32_t>();
+                }
+            }
+        }
+        for (uint32_t tier = 0; tier < ContentPack::ENEMY_TIERS; ++tier) {
+            tierWeights[tier] += record.spawnWeights[tier];
+        }
+
+        pack.enemies.push_back(record);
+    }
+
+    if (!data.empty()) {
+        for (uint32_t tier = 0; tier < ContentPack::ENEMY_TIERS; ++tier) {
+            if (tierWeights[tier] == 0) {
+                check.Warning("spawnWeights", "no enemy can spawn in difficulty tier " + std::to_string(tier));
+            }
+        }
+    }
+
+    std::cout << filePath << ": " << data.size() << " enemies" << std::endl;
+    return check.GetErrorCount();
+}
+
+// Parse a loot entry's count: a number or a [min, max] range
+void LootCount(Validator& check, const json& entry, const std::string& key, ContentPack::LootEntryRecord& record) {
+    record.minCount = 1;
+    record.maxCount = 1;
+    auto count = entry.find("count");
+    if (count == entry.end()) {
+        return;
+    }
+
+    if (count->is_number_integer()) {
+        record.minCount = record.maxCount = count->get<int32_t>();
+    } else if (count->is_array() && count->size() == 2 && (*count)[0].is_number_integer() &&
+               (*count)[1].is_number_integer()) {
+        record.minCount = (*count)[0].get<int32_t>();
+        record.maxCount = (*count)[1].get<int32_t>();
+    } else {
+        check.Error(key, "'count' must be a number or a [min, max] range");
+        return;
+    }
+    if (record.minCount < 0 || record.maxCount < record.minCount || record.maxCount > 1000000) {
+        check.Error(key, "'count' must satisfy 0 <= min <= max <= 1000000");
+    }
+}
+
+int CompileLoot(const std::string& filePath, PackBuilder& pack) {
+    json data;
+    if (!ParseFile(filePath, data)) {
+        return 1;
+    }
+
+    Validator check(filePath);
+    for (const auto& [id, table] : data.items()) {
+        if (!table.is_object()) {
+            check.Error(id, "expected an object");
+            continue;
+        }
+        if (pack.lootTableFiles.count(id) > 0) {
+            check.Error(id, "loot table ID is already defined by an earlier file");
+            continue;
+        }
+        pack.lootTableFiles[id] = filePath;
+
+        ContentPack::LootTableRecord record = {};
+        record.id = pack.AddString(id);
+        record.firstEntry = static_cast<uint32_t>(pack.lootEntries.size());
+
+        auto entries = table.find("entries");
+        if (entries == table.end() || !entries->is_array()) {
+            check.Error(id, "missing required array 'entries'");
+            continue;
+        }
+
+        uint32_t tierWeights[ContentPack::LOOT_TIERS] = {};
+        for (const auto& entry : *entries) {
+            if (!entry.is_object() || entry.contains("item") == entry.contains("table")) {
+                check.Error(id, "each entry needs exactly one of 'item' or 'table'");
+                continue;
+            }
+
+            ContentPack::LootEntryRecord entryRecord = {};
+            entryRecord.isTable = entry.contains("table") ? 1 : 0;
+            std::string target = check.String(entry, id, entryRecord.isTable ? "table" : "item", true);
+            if (entryRecord.isTable) {
+                pack.lootTableRefs[id].push_back(target);
+            } else if (pack.itemIds.count(target) == 0) {
+                // Items must already be compiled, so --items comes first
+                check.Error(id, "unknown item '" + target + "'");
+            }
+            entryRecord.target = pack.AddString(target);
+            LootCount(check, entry, id, entryRecord);
+
+            for (uint32_t& weight : entryRecord.weights) {
+                weight = 1;
+            }
+            auto weights = entry.find("weights");
+            if (weights != entry.end()) {
+                if (!weights->is_array() || weights->size() != ContentPack::LOOT_TIERS) {
+                    check.Error(id, "'weights' must be an array of " + std::to_string(ContentPack::LOOT_TIERS) +
+                                    " weights, one per quality tier");
+                } else {
+                    for (uint32_t tier = 0; tier < ContentPack::LOOT_TIERS; ++tier) {
+                        const json& weight = (*weights)[tier];
+                        if (!weight.is_number_integer() || weight.get<long long>() < 0 ||
+                            weight.get<long long>() > 1000000) {
+                            check.Error(id, "loot weights must be integers in 0..1000000");
+                            continue;
+                        }
+                        entryRecord.weights[tier] = weight.get<uint32_t>();
+                    }
+                }
+            }
+            for (uint32_t tier = 0; tier < ContentPack::LOOT_TIERS; ++tier) {
+                tierWeights[tier] += entryRecord.weights[tier];
+            }
+
+            pack.lootEntries.push_back(entryRecord);
+        }
+        record.entryCount = static_cast<uint32_t>(pack.lootEntries.size()) - record.firstEntry;
+
+        for (uint32_t tier = 0; tier < ContentPack::LOOT_TIERS; ++tier) {
+            if (tierWeights[tier] == 0) {
+                check.Warning(id, "rolls nothing in quality tier " + std::to_string(tier));
+            }
+        }
+
+        pack.lootTables.push_back(record);
+    }
+
+    std::cout << filePath << ": " << data.size() << " loot tables" << std::endl;
+    return check.GetErrorCount();
+}
+
+// Every nested table must exist, and no table may end up rolling itself
+int CheckLootTables(const PackBuilder& pack) {
+    int errors = 0;
+    for (const auto& [id, refs] : pack.lootTableRefs) {
+        Validator check(pack.lootTableFiles.at(id));
+        for (const std::string& ref : refs) {
+            if (pack.lootTableFiles.count(ref) == 0) {
+                check.Error(id, "unknown loot table '" + ref + "'");
+            }
+        }
+        errors += check.GetErrorCount();
+    }
+
+    // Depth-first search; 1 = on the current path, 2 = finished
+    std::map<std::string, int> state;
+    std::vector<std::pair<std::string, size_t>> stack;
+    for (const auto& [root, file] : pack.lootTableFiles) {
+        if (state[root] != 0) {
+            continue;
+        }
+        state[root] = 1;
+        stack.push_back({root, 0});
+        while (!stack.empty()) {
+            auto& [id, next] = stack.back();
+            auto refs = pack.lootTableRefs.find(id);
+            if (refs == pack.lootTableRefs.end() || next >= refs->second.size()) {
+                state[id] = 2;
+                stack.pop_back();
+                continue;
+            }
+
+            const std::string& ref = refs->second[next++];
+            if (pack.lootTableFiles.count(ref) == 0) {
+                continue;
+            }
+            if (state[ref] == 1) {
+                Validator check(pack.lootTableFiles.at(id));
+                check.Error(id, "rolling loot table '" + ref + "' leads back to itself");
+                errors += check.GetErrorCount();
+            } else if (state[ref] == 0) {
+                state[ref] = 1;
+                stack.push_back({ref, 0});
+            }
+        }
+    }
+    return errors;
+}
+
+uint64_t AlignUp(uint64_t value) {
+    return (value + 7) & ~static_cast<uint64_t>(7);
+}
+
+bool WritePack(const PackBuilder& pack, const std::string& outPath) {
+    struct Pending {
+        ContentPack::SectionKind kind;
+        uint32_t count;
+        const void* data;
+        uint64_t size;
+    };
+    const Pending pending[] = {
+        {ContentPack::SectionKind::STRINGS, static_cast<uint32_t>(pack.strings.size()),
+         pack.strings.data(), pack.strings.size()},
+        {ContentPack::SectionKind::ACTIONS, static_cast<uint32_t>(pack.actions.size()),
+         pack.actions.data(), pack.actions.size() * sizeof(ContentPack::ActionRecord)},
+        {ContentPack::SectionKind::ACTION_PROPERTIES, static_cast<uint32_t>(pack.properties.size()),
+         pack.properties.data(), pack.properties.size() * sizeof(ContentPack::PropertyRecord)},
+        {ContentPack::SectionKind::ITEMS, static_cast<uint32_t>(pack.items.size()),
+         pack.items.data(), pack.items.size() * sizeof(ContentPack::ItemRecord)},
+        {ContentPack::SectionKind::ENEMIES, static_cast<uint32_t>(pack.enemies.size()),
+         pack.enemies.data(), pack.enemies.size() * sizeof(ContentPack::EnemyRecord)},
+        {ContentPack::SectionKind::ENEMY_ACTIONS, static_cast<uint32_t>(pack.enemyActions.size()),
+         pack.enemyActions.data(), pack.enemyActions.size() * sizeof(ContentPack::StringRef)},
+        {ContentPack::SectionKind::LOOT_TABLES, static_cast<uint32_t>(pack.lootTables.size()),
+         pack.lootTables.data(), pack.lootTables.size() * sizeof(ContentPack::LootTableRecord)},
+        {ContentPack::SectionKind::LOOT_ENTRIES, static_cast<uint32_t>(pack.lootEntries.size()),
+         pack.lootEntries.data(), pack.lootEntries.size() * sizeof(ContentPack::LootEntryRecord)}
+    };
+    const uint32_t sectionCount = sizeof(pending) / sizeof(pending[0]);
+
+    ContentPack::Header header = {};
+    header.magic = ContentPack::MAGIC;
+    header.version = ContentPack::VERSION;
+    header.headerSize = sizeof(ContentPack::Header);
+    header.sectionCount = sectionCount;
+
+    std::vector<ContentPack::Section> sections(sectionCount);
+    uint64_t offset = AlignUp(sizeof(header) + sectionCount * sizeof(ContentPack::Section));
+    for (uint32_t i = 0; i < sectionCount; ++i) {
+        sections[i].kind = static_cast<uint32_t>(pending[i].kind);
+        sections[i].count = pending[i].count;
+        sections[i].offset = offset;
+        sections[i].size = pending[i].size;
+        offset = AlignUp(offset + pending[i].size);
+    }
+    header.fileSize = offset;
+
+    std::vector<char> buffer(header.fileSize, 0);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + sizeof(header), sections.data(), sections.size() * sizeof(ContentPack::Section));
+    for (uint32_t i = 0; i < sectionCount; ++i) {
+        if (pending[i].size > 0) {
+            std::memcpy(buffer.data() + sections[i].offset, pending[i].data, pending[i].size);
+        }
+    }
+
+    // Write next to the target and rename, so the game never maps a
+    // half-written pack
+    std::string tempPath = outPath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open file for writing: " << tempPath << std::endl;
+            return false;
+        }
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            std::cerr << "Error writing content pack to " << tempPath << std::endl;
+            return false;
+        }
+    }
+    if (std::rename(tempPath.c_str(), outPath.c_str()) != 0) {
+        std::cerr << "Error replacing content pack " << outPath << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    std::cout << "Wrote " << outPath << " (" << buffer.size() << " bytes, " << pack.actions.size() << " actions, "
+              << pack.items.size() << " items, " << pack.enemies.size() << " enemies, " << pack.lootTables.size() << " loot tables)" << std::endl;
+    return true;
+}
+
+void PrintUsage() {
+    std::cerr << "Usage: content_compiler --out pack.bin [--actions actions.json] [--items items.json]"
+              << " [--enemies enemies.json] [--loot loot.json]" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string outPath;
+    std::vector<std::string> actionFiles;
+    std::vector<std::string> itemFiles;
+    std::vector<std::string> enemyFiles;
+    std::vector<std::string> lootFiles;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            PrintUsage();
+            return 1;
+        }
+
+        if (arg == "--out") outPath = argv[++i];
+        else if (arg == "--actions") actionFiles.push_back(argv[++i]);
+        else if (arg == "--items") itemFiles.push_back(argv[++i]);
+        else if (arg == "--enemies") enemyFiles.push_back(argv[++i]);
+        else if (arg == "--loot") lootFiles.push_back(argv[++i]);
+        else {
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (outPath.empty()) {
+        PrintUsage();
+        return 1;
+    }
+
+    PackBuilder pack;
+    int errors = 0;
+    for (const std::string& file : actionFiles) {
+        errors += CompileActions(file, pack);
+    }
+    for (const std::string& file : itemFiles) {
+        errors += CompileItems(file, pack);
+    }
+    for (const std::string& file : enemyFiles) {
+        errors += CompileEnemies(file, pack);
+    }
+    for (const std::string& file : lootFiles) {
+        errors += CompileLoot(file, pack);
+    }
+    errors += CheckLootTables(pack);
+
+    if (errors > 0) {
+        std::cerr << errors << " error(s); " << outPath << " was not written" << std::endl;
+        return 1;
+    }
+
+    return WritePack(pack, outPath) ? 0 : 1;
+}
@@ -0,0 +1,258 @@
+// Headless batch generator for tuning dungeon parameters.
+// Generates many seeded floors across all cores and writes one CSV row of
+// layout metrics per floor, followed by a throughput and quality summary.
+// Build and run with: make batch-dungeon BATCH_ARGS="--floors 5000 --loops 0.3"
+
+#include "game/dungeon/DungeonGenerator.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Game;
+
+namespace {
+
+struct BatchOptions {
+    int floors = 1000;
+    int threads = 0;                // 0 = one per hardware thread
+    uint64_t baseSeed = 1;
+    std::string outPath;            // Empty = CSV to stdout
+    DungeonGenerationParams params;
+};
+
+struct FloorMetrics {
+    uint64_t seed = 0;
+    int rooms = 0;
+    int connections = 0;
+    int criticalPath = -1;          // Doors from entrance to exit (-1 if unreachable)
+    int loops = 0;                  // Independent cycles: edges - rooms + components
+    int deadEnds = 0;               // Rooms with a single door
+    int treasureRooms = 0;
+    double treasureDistance = 0.0;  // Mean doors from entrance to treasure rooms
+    int unreachable = 0;            // Rooms not reachable from the entrance
+    bool exitMissing = false;
+    bool bossMissing = false;
+    double generationUs = 0.0;
+};
+
+void PrintUsage() {
+    std::cerr << "Usage: dungeon_batch [--floors N] [--threads N] [--seed S] [--out file.csv]\n"
+              << "                     [--width W] [--height H] [--rooms N] [--treasure N]\n"
+              << "                     [--difficulty N] [--loops F] [--no-boss] [--wfc]" << std::endl;
+}
+
+bool ParseOptions(int argc, char** argv, BatchOptions& options) {
+    options.params = DungeonGenerationParams(10, 10, 20, 3, true, 1, 0.2f);
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+        if (arg == "--no-boss") {
+            options.params.hasBossRoom = false;
+            continue;
+        }
+        if (arg == "--wfc") {
+            options.params.layout = LayoutAlgorithm::WAVE_FUNCTION_COLLAPSE;
+            continue;
+        }
+        if (!value) {
+            PrintUsage();
+            return false;
+        }
+
+        if (arg == "--floors") options.floors = std::max(1, std::atoi(value));
+        else if (arg == "--threads") options.threads = std::max(0, std::atoi(value));
+        else if (arg == "--seed") options.baseSeed = std::strtoull(value, nullptr, 10);
+        else if (arg == "--out") options.outPath = value;
+        else if (arg == "--width") options.params.width = std::max(2, std::atoi(value));
+        else if (arg == "--height") options.params.height = std::max(1, std::atoi(value));
+        else if (arg == "--rooms") options.params.numRooms = std::max(5, std::atoi(value));
+        else if (arg == "--treasure") options.params.numTreasureRooms = std::max(0, std::atoi(value));
+        else if (arg == "--difficulty") options.params.difficulty = std::max(1, std::atoi(value));
+        else if (arg == "--loops") options.params.loopChance = static_cast<float>(std::atof(value));
+        else {
+            PrintUsage();
+            return false;
+        }
+        ++i;
+    }
+
+    return true;
+}
+
+// Number of connected components, via union-find over the edge list
+int CountComponents(const DungeonFloor& floor) {
+    std::vector<int> parent(floor.GetRoomCount());
+    std::iota(parent.begin(), parent.end(), 0);
+
+    auto find = [&parent](int room) {
+        while (parent[room] != room) {
+            parent[room] = parent[parent[room]];
+            room = parent[room];
+        }
+        return room;
+    };
+
+    int components = floor.GetRoomCount();
+    for (const auto& edge : floor.GetConnections()) {
+        int a = find(edge.first);
+        int b = find(edge.second);
+        if (a != b) {
+            parent[a] = b;
+            components--;
+        }
+    }
+    return components;
+}
+
+FloorMetrics Measure(const DungeonFloor& floor, bool wantBoss) {
+    FloorMetrics metrics;
+    metrics.rooms = floor.GetRoomCount();
+    metrics.connections = floor.GetConnectionCount();
+    metrics.loops = metrics.connections - metrics.rooms + CountComponents(floor);
+    metrics.exitMissing = floor.GetExitIndex() == DungeonFloor::NO_ROOM;
+    metrics.bossMissing = wantBoss && floor.GetBossIndex() == DungeonFloor::NO_ROOM;
+
+    const DistanceField& field = floor.GetDistanceField();
+    bool hasEntrance = floor.GetEntranceIndex() != DungeonFloor::NO_ROOM;
+
+    if (hasEntrance && !metrics.exitMissing) {
+        metrics.criticalPath = field.GetDistance(DistanceLane::ENTRANCE, floor.GetExitIndex());
+    }
+    metrics.unreachable = metrics.rooms - (hasEntrance ? field.GetReachedCount(DistanceLane::ENTRANCE) : 0);
+
+    int treasureDistanceSum = 0;
+    int reachableTreasure = 0;
+    for (const Room& room : floor.GetRooms()) {
+        if (floor.GetNeighbors(room.GetId()).size() == 1) {
+            metrics.deadEnds++;
+        }
+
+        if (room.GetType() == RoomType::TREASURE) {
+            metrics.treasureRooms++;
+            if (hasEntrance && field.IsReachable(DistanceLane::ENTRANCE, room.GetId())) {
+                treasureDistanceSum += field.GetDistance(DistanceLane::ENTRANCE, room.GetId());
+                reachableTreasure++;
+            }
+        }
+    }
+    if (reachableTreasure > 0) {
+        metrics.treasureDistance = static_cast<double>(treasureDistanceSum) / reachableTreasure;
+    }
+
+    return metrics;
+}
+
+void WriteCsv(std::ostream& out, const BatchOptions& options, const std::vector<FloorMetrics>& results) {
+    out << "seed,width,height,loop_chance,rooms,connections,critical_path,loops,dead_ends,"
+        << "treasure_rooms,treasure_distance,unreachable,exit_missing,boss_missing,generation_us\n";
+
+    for (const FloorMetrics& m : results) {
+        out << m.seed << ',' << options.params.width << ',' << options.params.height << ','
+            << options.params.loopChance << ',' << m.rooms << ',' << m.connections << ','
+            << m.criticalPath << ',' << m.loops << ',' << m.deadEnds << ','
+            << m.treasureRooms << ',' << std::fixed << std::setprecision(2) << m.treasureDistance << ','
+            << m.unreachable << ',' << (m.exitMissing ? 1 : 0) << ',' << (m.bossMissing ? 1 : 0) << ','
+            << std::setprecision(1) << m.generationUs << std::defaultfloat << '\n';
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BatchOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    int threadCount = options.threads > 0 ? options.threads
+                                          : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    threadCount = std::min(threadCount, options.floors);
+
+    std::vector<FloorMetrics> results(options.floors);
+    std::atomic<int> nextFloor(0);
+
+    // Each worker owns a quiet generator and claims floors one at a time;
+    // results land in their floor's slot, so the CSV order is deterministic
+    auto worker = [&]() {
+        DungeonGenerator generator;
+        generator.SetVerbose(false);
+
+        for (int index = nextFloor++; index < options.floors; index = nextFloor++) {
+            DungeonGenerationParams params = options.params;
+            params.seed = options.baseSeed + static_cast<uint64_t>(index);
+
+            auto start = std::chrono::steady_clock::now();
+            std::shared_ptr<DungeonFloor> floor = generator.GenerateFloor(params);
+            double elapsedUs = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start).count();
+
+            FloorMetrics metrics = Measure(*floor, params.hasBossRoom);
+            metrics.seed = params.seed;
+            metrics.generationUs = elapsedUs;
+            results[index] = metrics;
+        }
+    };
+
+    auto batchStart = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+    if (options.outPath.empty()) {
+        WriteCsv(std::cout, options, results);
+    } else {
+        std::ofstream file(options.outPath);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open file for writing: " << options.outPath << std::endl;
+            return 1;
+        }
+        WriteCsv(file, options, results);
+    }
+
+    // Summary (stderr, so it never mixes with CSV on stdout)
+    long long rooms = 0;
+    double criticalPath = 0.0, loops = 0.0, deadEnds = 0.0;
+    int unreachableFloors = 0, exitFailures = 0, bossFailures = 0, pathFloors = 0;
+    for (const FloorMetrics& m : results) {
+        rooms += m.rooms;
+        loops += m.loops;
+        deadEnds += m.deadEnds;
+        if (m.criticalPath >= 0) {
+            criticalPath += m.criticalPath;
+            pathFloors++;
+        }
+        if (m.unreachable > 0) unreachableFloors++;
+        if (m.exitMissing) exitFailures++;
+        if (m.bossMissing) bossFailures++;
+    }
+
+    std::cerr << std::fixed << std::setprecision(2)
+              << options.floors << " floors on " << threadCount << " threads in " << seconds * 1000.0 << " ms ("
+              << std::setprecision(0) << options.floors / seconds << " floors/sec, "
+              << rooms / seconds << " rooms/sec)" << std::endl
+              << std::setprecision(2)
+              << "  mean critical path " << (pathFloors > 0 ? criticalPath / pathFloors : 0.0)
+              << ", loops " << loops / options.floors
+              << ", dead ends " << deadEnds / options.floors << std::endl
+              << "  floors with unreachable rooms " << unreachableFloors
+              << ", exit failures " << exitFailures
+              << ", boss failures " << bossFailures << std::endl;
+
+    return 0;
+}
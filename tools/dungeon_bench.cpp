@@ -0,0 +1,75 @@
+// Headless dungeon generation benchmark.
+// Generates floors on growing grids with each layout algorithm and reports
+// the mean time per floor and rooms generated per second.
+// Build and run with: make bench-dungeon
+
+#include "game/dungeon/DungeonGenerator.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace Game;
+
+int main(int argc, char** argv) {
+    // Optional argument: largest grid side (default 1000)
+    int maxSide = argc > 1 ? std::atoi(argv[1]) : 1000;
+    if (maxSide < 16) maxSide = 16;
+    
+    // 8x8 is the interactive default; the rest doubles up to the largest grid
+    std::vector<int> sides;
+    for (int side = 8; side < maxSide; side *= 2) {
+        sides.push_back(side);
+    }
+    sides.push_back(maxSide);
+    
+    DungeonGenerator generator;
+    generator.SetVerbose(false);
+    
+    const LayoutAlgorithm layouts[] = {LayoutAlgorithm::RANDOM_WALK, LayoutAlgorithm::WAVE_FUNCTION_COLLAPSE};
+    
+    std::cout << std::setw(12) << "grid" << std::setw(8) << "layout" << std::setw(12) << "rooms"
+              << std::setw(12) << "edges" << std::setw(12) << "us/floor"
+              << std::setw(16) << "rooms/sec" << std::endl;
+    
+    for (int side : sides) {
+        for (LayoutAlgorithm layout : layouts) {
+            DungeonGenerationParams params;
+            params.width = side;
+            params.height = side;
+            params.numRooms = std::max(5, side * side / 8);
+            params.numTreasureRooms = params.numRooms / 20;
+            params.hasBossRoom = true;
+            params.difficulty = 5;
+            params.loopChance = 0.2f;
+            params.layout = layout;
+            
+            // Repeat small grids so every row measures a comparable amount of
+            // work, over a different seed each time so one lucky or unlucky
+            // floor can't decide the row. Both layouts see the same seeds.
+            int repeats = std::max(1, 200000 / params.numRooms);
+            long long rooms = 0;
+            long long edges = 0;
+            
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < repeats; ++i) {
+                params.seed = 0x5EED0000ULL + (static_cast<uint64_t>(side) << 32) + i;
+                auto floor = generator.GenerateFloor(params);
+                rooms += floor->GetRoomCount();
+                edges += floor->GetConnectionCount();
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            double perFloorUs = seconds * 1e6 / repeats;
+            
+            std::cout << std::setw(12) << (std::to_string(side) + "x" + std::to_string(side))
+                      << std::setw(8) << (layout == LayoutAlgorithm::RANDOM_WALK ? "walk" : "wfc")
+                      << std::setw(12) << rooms / repeats << std::setw(12) << edges / repeats
+                      << std::setw(12) << std::fixed << std::setprecision(2) << perFloorUs
+                      << std::setw(16) << std::setprecision(0) << (rooms / seconds) << std::endl;
+        }
+    }
+    
+    return 0;
+}